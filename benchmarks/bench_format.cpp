@@ -0,0 +1,106 @@
+// dear imgui: benchmark for integer formatting/parsing: DataTypeFormatString(), DataTypeApplyOpFromText() and ColorEdit4()
+// See benchmarks/README.txt for build instructions.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+
+static const int COLORS_COUNT = 400;
+static float Colors[COLORS_COUNT][4];
+
+static double GetTimeInMs()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+}
+
+static int CompareDoubles(const void* lhs, const void* rhs)
+{
+    const double a = *(const double*)lhs, b = *(const double*)rhs;
+    return (a < b) ? -1 : (a > b) ? 1 : 0;
+}
+
+static void RenderColorEditFrame(ImGuiColorEditFlags flags)
+{
+    ImGui::GetIO().DeltaTime = 1.0f / 60.0f;
+    ImGui::NewFrame();
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1900, 2500));
+    ImGui::Begin("ColorEdit4");
+    ImGui::Columns(4, NULL, false);
+    for (int n = 0; n < COLORS_COUNT; n++)
+    {
+        ImGui::PushID(n);
+        ImGui::ColorEdit4("##color", Colors[n], flags);
+        ImGui::PopID();
+        ImGui::NextColumn();
+    }
+    ImGui::End();
+    ImGui::Render();
+}
+
+int main(int, char**)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 2600);
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    for (int n = 0; n < COLORS_COUNT; n++)
+        for (int c = 0; c < 4; c++)
+            Colors[n][c] = ((n * 37 + c * 91) % 256) / 255.0f;
+
+    // Whole frames: 400 ColorEdit4() in RGB mode (4 DragInt formatting "R:%3d" etc.) and in hex mode. Median of 5 runs.
+    const ImGuiColorEditFlags modes[] = { ImGuiColorEditFlags_DisplayRGB, ImGuiColorEditFlags_DisplayHex };
+    const char* mode_names[] = { "RGB", "hex" };
+    const int FRAMES_COUNT = 1500;
+    for (int mode_n = 0; mode_n < IM_ARRAYSIZE(modes); mode_n++)
+    {
+        double run_times[5];
+        for (int run_n = 0; run_n < IM_ARRAYSIZE(run_times); run_n++)
+        {
+            for (int frame_n = 0; frame_n < 20; frame_n++)
+                RenderColorEditFrame(modes[mode_n]);
+            double t0 = GetTimeInMs();
+            for (int frame_n = 0; frame_n < FRAMES_COUNT; frame_n++)
+                RenderColorEditFrame(modes[mode_n]);
+            run_times[run_n] = (GetTimeInMs() - t0) / FRAMES_COUNT;
+        }
+        qsort(run_times, IM_ARRAYSIZE(run_times), sizeof(double), CompareDoubles);
+        printf("%d ColorEdit4, %s: %.3f ms/frame\n", COLORS_COUNT, mode_names[mode_n], run_times[IM_ARRAYSIZE(run_times) / 2]);
+    }
+
+    // Single calls
+    const int CALLS_COUNT = 2000000;
+    char buf[64];
+    int sink = 0;
+    double t0 = GetTimeInMs();
+    for (int n = 0; n < CALLS_COUNT; n++)
+    {
+        int v = n & 255;
+        sink += ImGui::DataTypeFormatString(buf, IM_ARRAYSIZE(buf), ImGuiDataType_S32, &v, "R:%3d");
+    }
+    double t1 = GetTimeInMs();
+    for (int n = 0; n < CALLS_COUNT; n++)
+    {
+        int v = (int)((unsigned int)n * 7919u);
+        sink += ImGui::DataTypeFormatString(buf, IM_ARRAYSIZE(buf), ImGuiDataType_S32, &v, "%d");
+    }
+    double t2 = GetTimeInMs();
+    for (int n = 0; n < CALLS_COUNT; n++)
+    {
+        int v = n;
+        sink += ImGui::DataTypeApplyOpFromText("1234567", "0", ImGuiDataType_S32, &v, NULL) ? 1 : 0;
+    }
+    double t3 = GetTimeInMs();
+    printf("DataTypeFormatString(\"R:%%3d\"):     %.1f ns\n", (t1 - t0) * 1e6 / CALLS_COUNT);
+    printf("DataTypeFormatString(\"%%d\"):        %.1f ns\n", (t2 - t1) * 1e6 / CALLS_COUNT);
+    printf("DataTypeApplyOpFromText(\"1234567\"): %.1f ns\n", (t3 - t2) * 1e6 / CALLS_COUNT);
+    printf("(%d)\n", sink);
+
+    ImGui::DestroyContext();
+    return 0;
+}
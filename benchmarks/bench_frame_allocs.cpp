@@ -0,0 +1,168 @@
+// dear imgui: allocations per frame in steady state (IM_ALLOC() calls, per memory tag), and use of the frame arena (IM_ALLOC_FRAME())
+// See benchmarks/README.txt for build instructions. Requires -DIMGUI_ENABLE_MEMORY_ACCOUNTING.
+// Runs a window with common widgets, an active InputText() being typed into, Columns() and the Metrics window, and checks that
+// once every buffer reached its size, frames don't allocate anymore: transient allocations go to the frame arena instead.
+// Usage: bench_frame_allocs [frames_count]
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+
+#ifndef IMGUI_ENABLE_MEMORY_ACCOUNTING
+#error "Build with -DIMGUI_ENABLE_MEMORY_ACCOUNTING"
+#endif
+
+static int AllocCount = 0;
+static void* CountingAlloc(size_t size, void*) { AllocCount++; return malloc(size); }
+static void  CountingFree(void* ptr, void*)    { free(ptr); }
+
+static float PlotValues[500];
+static char  InputBuf[256] = "hello world";
+static char  MultilineBuf[1024] = "multi\nline";
+
+static double GetTimeInMs()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+}
+
+static void RenderFrame(int frame_n)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.DeltaTime = 1.0f / 60.0f;
+
+    // Type into the focused InputText(): a character every 7 frames, erased 3 frames later
+    io.KeysDown[io.KeyMap[ImGuiKey_Backspace]] = (frame_n > 20 && frame_n % 7 == 3);
+    if (frame_n > 20 && frame_n % 7 == 0)
+        io.AddInputCharacter('a' + frame_n % 26);
+
+    ImGui::NewFrame();
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(900, 1000));
+    ImGui::Begin("Widgets", NULL, ImGuiWindowFlags_MenuBar);
+    if (ImGui::BeginMenuBar())
+    {
+        if (ImGui::BeginMenu("File"))
+        {
+            ImGui::MenuItem("Open");
+            ImGui::EndMenu();
+        }
+        ImGui::EndMenuBar();
+    }
+    static float col[4] = { 0.2f, 0.4f, 0.6f, 0.5f };
+    static int int_value = 3;
+    static float float_value = 1.0f;
+    static int item_current = 0;
+    const char* items[] = { "AAAA", "BBBB", "CCCC" };
+    ImGui::Text("Frame %03d, value %.3f", frame_n % 1000, (frame_n % 100) * 0.5f);
+    ImGui::TextWrapped("Wrapped text %03d: lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt", frame_n % 1000);
+    if (frame_n == 10)
+        ImGui::SetKeyboardFocusHere();
+    ImGui::InputText("input", InputBuf, IM_ARRAYSIZE(InputBuf));
+    ImGui::InputTextMultiline("multiline", MultilineBuf, IM_ARRAYSIZE(MultilineBuf));
+    ImGui::ColorEdit4("color", col);
+    ImGui::ColorPicker4("picker", col);
+    ImGui::SliderInt("slider", &int_value, 0, 100);
+    ImGui::DragFloat("drag", &float_value);
+    ImGui::InputInt("int", &int_value);
+    ImGui::InputFloat("float", &float_value);
+    ImGui::Combo("combo", &item_current, items, IM_ARRAYSIZE(items));
+    ImGui::ListBox("listbox", &item_current, items, IM_ARRAYSIZE(items));
+    ImGui::PlotLines("lines", PlotValues, IM_ARRAYSIZE(PlotValues));
+    ImGui::PlotHistogram("histogram", PlotValues, 100);
+    ImGui::BulletText("Bullet %s", "text");
+    ImGui::LabelText("label", "Value %03d", frame_n % 1000);
+    if (ImGui::TreeNode("Tree"))
+    {
+        for (int n = 0; n < 20; n++)
+            ImGui::Selectable("Selectable", n == 3);
+        ImGui::TreePop();
+    }
+    ImGui::Columns(3);
+    for (int n = 0; n < 30; n++)
+    {
+        ImGui::Text("Cell %d", n);
+        ImGui::NextColumn();
+    }
+    ImGui::Columns(1);
+    ImGui::BeginChild("child", ImVec2(200, 100), true);
+    for (int n = 0; n < 30; n++)
+        ImGui::Text("Line %d", n);
+    ImGui::EndChild();
+    if (ImGui::BeginTabBar("tabs"))
+    {
+        if (ImGui::BeginTabItem("Tab A"))
+        {
+            ImGui::Text("Tab A");
+            ImGui::EndTabItem();
+        }
+        if (ImGui::BeginTabItem("Tab B"))
+            ImGui::EndTabItem();
+        ImGui::EndTabBar();
+    }
+    ImGui::SetTooltip("Tooltip %03d", frame_n % 1000);
+    ImGui::End();
+    ImGui::ShowMetricsWindow();
+    ImGui::Render();
+}
+
+int main(int argc, char** argv)
+{
+    const int frames_count = (argc > 1) ? ImMax(atoi(argv[1]), 200) : 1000;
+
+    ImGui::SetAllocatorFunctions(CountingAlloc, CountingFree);
+    ImGuiContext* ctx = ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.MousePos = ImVec2(1500, 1000);
+    io.KeyMap[ImGuiKey_Backspace] = 8;
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    for (int n = 0; n < IM_ARRAYSIZE(PlotValues); n++)
+        PlotValues[n] = (float)(n % 37);
+
+    // Open the Memory and Frame Arena sections of the Metrics window, which have per-frame temporaries of their own
+    RenderFrame(0);
+    ImGuiWindow* metrics_window = ImGui::FindWindowByName("Dear ImGui Metrics");
+    const ImGuiID memory_id = ImHashStr("Memory", 0, metrics_window->ID);
+    metrics_window->StateStorage.SetInt(memory_id, 1);
+    metrics_window->StateStorage.SetInt(ImHashStr("WindowsMemory", 0, memory_id), 1);
+    metrics_window->StateStorage.SetInt(ImHashStr("FrameArena", 0, metrics_window->ID), 1);
+
+    // Warm up: buffers grow to their steady size
+    const int warmup_frames_count = 100;
+    for (int frame_n = 1; frame_n < warmup_frames_count; frame_n++)
+        RenderFrame(frame_n);
+
+    int steady_allocs_count = 0;
+    int steady_frames_with_allocs = 0;
+    int tag_allocs_count[ImGuiMemTag_COUNT] = {};
+    double t0 = GetTimeInMs();
+    for (int frame_n = warmup_frames_count; frame_n < frames_count; frame_n++)
+    {
+        const int allocs_count_before = AllocCount;
+        RenderFrame(frame_n);
+        steady_allocs_count += AllocCount - allocs_count_before;
+        steady_frames_with_allocs += (AllocCount != allocs_count_before) ? 1 : 0;
+        for (int tag = 0; tag < ImGuiMemTag_COUNT; tag++)
+            tag_allocs_count[tag] += ctx->MemTagAllocCountPrevFrame[tag];
+    }
+    double t1 = GetTimeInMs();
+
+    const char* tag_names[] = { "Misc", "Windows", "DrawLists", "FontAtlas", "Storage", "Settings", "TextEdit", "FrameArena" };
+    IM_STATIC_ASSERT(IM_ARRAYSIZE(tag_names) == ImGuiMemTag_COUNT);
+    printf("%d frames after %d warm-up frames: %.3f ms/frame\n", frames_count - warmup_frames_count, warmup_frames_count, (t1 - t0) / (frames_count - warmup_frames_count));
+    printf("IM_ALLOC() calls: %d in %d frames\n", steady_allocs_count, steady_frames_with_allocs);
+    for (int tag = 0; tag < ImGuiMemTag_COUNT; tag++)
+        printf("  %-10s %d\n", tag_names[tag], tag_allocs_count[tag]);
+    const ImGuiFrameArena& arena = ctx->FrameArena;
+    printf("Frame arena: %d bytes in the last frame, high-water %d bytes, %d call-sites\n", (int)arena.UsedBytesPrevFrame, (int)arena.UsedBytesMax, arena.Callsites.Size);
+
+    ImGui::DestroyContext();
+    IM_ASSERT(steady_allocs_count == 0);
+    printf("OK\n");
+    return 0;
+}
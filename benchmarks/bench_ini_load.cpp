@@ -0,0 +1,72 @@
+// dear imgui: benchmark for LoadIniSettingsFromMemory() / LoadIniSettingsFromDisk() on a large .ini file
+// See benchmarks/README.txt for build instructions.
+// Usage: bench_ini_load [windows_count] [custom_entries_count]
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+
+static const char* BENCH_INI_FILENAME = "bench_ini_load.ini";
+
+static double GetTimeInMs()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+}
+
+// A custom settings handler, standing for the application/extensions entries found in real .ini files
+static int CustomSettingsLinesCount = 0;
+static void* CustomSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char*)                  { return (void*)1; }
+static void  CustomSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void*, const char* line)      { if (line[0]) CustomSettingsLinesCount++; }
+static void  CustomSettingsHandler_WriteAll(ImGuiContext*, ImGuiSettingsHandler*, ImGuiTextBuffer*)             { }
+
+int main(int argc, char** argv)
+{
+    const int windows_count = (argc > 1) ? atoi(argv[1]) : 60000;
+    const int custom_count = (argc > 2) ? atoi(argv[2]) : 90000;
+
+    ImGuiTextBuffer ini;
+    for (int n = 0; n < windows_count; n++)
+        ini.appendf("[Window][Tool Window %d##%08X]\nPos=%d,%d\nSize=%d,%d\nCollapsed=%d\n\n", n, n * 2654435761u, n % 1900, n % 1000, 100 + n % 700, 50 + n % 500, n & 1);
+    for (int n = 0; n < custom_count; n++)
+        ini.appendf("[Custom][Entry %d]\nValue=%d\nName=entry_%d\nFlags=0x%08X\n\n", n, n * 7, n, n);
+    printf("%d windows, %d custom entries: %.2f MB\n", windows_count, custom_count, ini.size() / (1024.0 * 1024.0));
+
+    FILE* f = fopen(BENCH_INI_FILENAME, "wb");
+    if (!f)
+        return 1;
+    fwrite(ini.c_str(), 1, (size_t)ini.size(), f);
+    fclose(f);
+
+    for (int from_disk = 0; from_disk < 2; from_disk++)
+    {
+        ImGui::CreateContext();
+        ImGui::GetIO().IniFilename = NULL;
+        ImGuiSettingsHandler handler;
+        handler.TypeName = "Custom";
+        handler.TypeHash = ImHashStr("Custom");
+        handler.ReadOpenFn = CustomSettingsHandler_ReadOpen;
+        handler.ReadLineFn = CustomSettingsHandler_ReadLine;
+        handler.WriteAllFn = CustomSettingsHandler_WriteAll;
+        ImGui::GetCurrentContext()->SettingsHandlers.push_back(handler);
+        CustomSettingsLinesCount = 0;
+
+        double t0 = GetTimeInMs();
+        if (from_disk)
+            ImGui::LoadIniSettingsFromDisk(BENCH_INI_FILENAME);
+        else
+            ImGui::LoadIniSettingsFromMemory(ini.c_str(), (size_t)ini.size());
+        double t1 = GetTimeInMs();
+
+        ImGuiContext& g = *ImGui::GetCurrentContext();
+        int settings_count = 0;
+        for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
+            settings_count++;
+        IM_ASSERT(settings_count == windows_count && CustomSettingsLinesCount == custom_count * 3);
+        printf("%s: %.1f ms\n", from_disk ? "LoadIniSettingsFromDisk  " : "LoadIniSettingsFromMemory", t1 - t0);
+        ImGui::DestroyContext();
+    }
+    remove(BENCH_INI_FILENAME);
+    return 0;
+}
@@ -0,0 +1,58 @@
+// dear imgui: benchmark for ImGuiStorage, sorted (default) vs hash index (SetHashIndex(true))
+// See benchmarks/README.txt for build instructions.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <chrono>
+
+static double GetTimeInNs()
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+}
+
+int main(int, char**)
+{
+    const int sizes[] = { 1000, 100000, 1000000 };
+    for (int size_n = 0; size_n < IM_ARRAYSIZE(sizes); size_n++)
+    {
+        const int keys_count = sizes[size_n];
+        ImVector<ImGuiID> keys;
+        keys.resize(keys_count);
+        for (int n = 0; n < keys_count; n++)
+            keys[n] = ImHashData(&n, sizeof(n), 0);
+
+        for (int hashed = 0; hashed < 2; hashed++)
+        {
+            ImGuiStorage storage;
+            storage.SetHashIndex(hashed != 0);
+
+            // Inserting 1M random keys one at a time in a sorted storage is O(N^2): build it in bulk instead.
+            const bool bulk_insert = (!hashed && keys_count >= 1000000);
+            double t0 = GetTimeInNs();
+            if (bulk_insert)
+            {
+                for (int n = 0; n < keys_count; n++)
+                    storage.Data.push_back(ImGuiStorage::ImGuiStoragePair(keys[n], n));
+                storage.BuildSortByKey();
+            }
+            else
+            {
+                for (int n = 0; n < keys_count; n++)
+                    storage.SetInt(keys[n], n);
+            }
+            double t1 = GetTimeInNs();
+
+            // Look keys up in a scattered order, 4 times each
+            long long sum = 0;
+            for (int rep = 0; rep < 4; rep++)
+                for (int n = 0; n < keys_count; n++)
+                    sum += storage.GetInt(keys[(int)(((long long)n * 7919) % keys_count)]);
+            double t2 = GetTimeInNs();
+            IM_ASSERT(sum == 4 * ((long long)keys_count * (keys_count - 1) / 2));
+
+            printf("%7d keys, %s: insert%s %.1f ns/key, lookup %.1f ns/key\n", keys_count, hashed ? "hashed" : "sorted", bulk_insert ? " (bulk + sort)" : "", (t1 - t0) / keys_count, (t2 - t1) / (4.0 * keys_count));
+        }
+    }
+    return 0;
+}
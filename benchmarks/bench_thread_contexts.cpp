@@ -0,0 +1,145 @@
+// dear imgui: N contexts updated by N threads at the same time, sharing a font atlas (IMGUI_ENABLE_THREAD_LOCAL_CONTEXT)
+// See benchmarks/README.txt for build instructions. Requires -DIMGUI_ENABLE_THREAD_LOCAL_CONTEXT, optionally -DIMGUI_ENABLE_PROFILER
+// and -DIMGUI_ENABLE_MEMORY_ACCOUNTING. Checks that every context produces the same draw data, and times the same work done
+// sequentially then in parallel. With memory accounting, also checks that the shared per-tag stats (GImMemTagStats) lose no update.
+// Usage: bench_thread_contexts [threads_count] [frames_count]
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <thread>
+
+#ifndef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+#error "Build with -DIMGUI_ENABLE_THREAD_LOCAL_CONTEXT"
+#endif
+
+static ImFontAtlas* SharedFontAtlas = NULL;
+
+struct ContextResult
+{
+    int     VtxCount;
+    int     IdxCount;
+    ImU32   VtxHash;
+};
+
+static void RunContext(int frames_count, ContextResult* out_result)
+{
+    ImGuiContext* ctx = ImGui::CreateContext(SharedFontAtlas);
+    IM_ASSERT(ImGui::GetCurrentContext() == ctx);
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1280, 800);
+    for (int frame_n = 0; frame_n < frames_count; frame_n++)
+    {
+        io.DeltaTime = 1.0f / 60.0f;
+        ImGui::NewFrame();
+        ImGui::Begin("Tool");
+        for (int n = 0; n < 200; n++)
+        {
+            float value = (float)n;
+            ImGui::PushID(n);
+            ImGui::Text("Item %d", n);
+            ImGui::SliderFloat("##value", &value, 0.0f, 100.0f);
+            ImGui::PopID();
+        }
+        ImGui::End();
+        ImGui::Render();
+    }
+
+    ImDrawData* draw_data = ImGui::GetDrawData();
+    out_result->VtxCount = draw_data->TotalVtxCount;
+    out_result->IdxCount = draw_data->TotalIdxCount;
+    out_result->VtxHash = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+        out_result->VtxHash = ImHashData(draw_data->CmdLists[n]->VtxBuffer.Data, (size_t)draw_data->CmdLists[n]->VtxBuffer.size_in_bytes(), out_result->VtxHash);
+
+#ifdef IMGUI_ENABLE_PROFILER
+    // Zones are tagged with the context which recorded them and its own frame numbers
+    ImVector<ImGuiProfilerZone> zones;
+    ImGui::ProfilerCopyZones(&zones, frames_count, ctx);
+    for (int n = 0; n < zones.Size; n++)
+        IM_ASSERT(zones[n].Context == ctx && zones[n].Frame == frames_count);
+#endif
+
+    ImGui::DestroyContext(ctx);
+    IM_ASSERT(ImGui::GetCurrentContext() == NULL);
+}
+
+static double GetTimeInMs()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+}
+
+int main(int argc, char** argv)
+{
+    const int threads_count = (argc > 1) ? ImMax(atoi(argv[1]), 1) : 8;
+    const int frames_count = (argc > 2) ? ImMax(atoi(argv[2]), 1) : 50;
+
+    // Build the shared atlas and lock it before any context uses it: contexts never write to a shared atlas.
+    SharedFontAtlas = IM_NEW(ImFontAtlas)();
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    SharedFontAtlas->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    SharedFontAtlas->Locked = true;
+
+    ImVector<ContextResult> results;
+    results.resize(threads_count);
+    ImVector<std::thread*> threads;
+    threads.reserve(threads_count);
+#ifdef IMGUI_ENABLE_MEMORY_ACCOUNTING
+    // Allocations and active counts from before the first pass: all contexts are destroyed at the end of a pass
+    ImGuiMemTagStats mem_stats_start[ImGuiMemTag_COUNT];
+    memcpy(mem_stats_start, GImMemTagStats, sizeof(mem_stats_start));
+    int mem_allocs_sequential[ImGuiMemTag_COUNT] = {};
+#endif
+    for (int parallel = 0; parallel < 2; parallel++)
+    {
+        memset(results.Data, 0, (size_t)results.size_in_bytes());
+        double t0 = GetTimeInMs();
+        if (parallel)
+        {
+            threads.resize(0);
+            for (int n = 0; n < threads_count; n++)
+                threads.push_back(new std::thread(RunContext, frames_count, &results[n]));
+            for (int n = 0; n < threads_count; n++)
+            {
+                threads[n]->join();
+                delete threads[n];
+            }
+        }
+        else
+        {
+            for (int n = 0; n < threads_count; n++)
+                RunContext(frames_count, &results[n]);
+        }
+        double t1 = GetTimeInMs();
+
+        for (int n = 0; n < threads_count; n++)
+        {
+            IM_ASSERT(results[n].VtxCount > 0);
+            IM_ASSERT(results[n].VtxCount == results[0].VtxCount && results[n].IdxCount == results[0].IdxCount && results[n].VtxHash == results[0].VtxHash);
+        }
+        printf("%s: %d contexts x %d frames: %.1f ms (%d vertices per frame)\n", parallel ? "parallel  " : "sequential", threads_count, frames_count, t1 - t0, results[0].VtxCount);
+
+#ifdef IMGUI_ENABLE_MEMORY_ACCOUNTING
+        // Both passes do the same work: they must make the same allocations, and free all of them
+        for (int tag = 0; tag < ImGuiMemTag_COUNT; tag++)
+        {
+            const ImGuiMemTagStats& stats = GImMemTagStats[tag];
+            IM_ASSERT(stats.ActiveAllocCount == mem_stats_start[tag].ActiveAllocCount && stats.ActiveBytes == mem_stats_start[tag].ActiveBytes);
+            const int allocs_count = stats.AllocCount - mem_stats_start[tag].AllocCount;
+            if (parallel)
+                IM_ASSERT(allocs_count == 2 * mem_allocs_sequential[tag]);
+            else
+                mem_allocs_sequential[tag] = allocs_count;
+        }
+#endif
+    }
+
+    SharedFontAtlas->Locked = false;
+    IM_DELETE(SharedFontAtlas);
+    printf("OK\n");
+    return 0;
+}
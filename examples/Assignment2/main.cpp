@@ -115,6 +115,7 @@ int main(int, char**)
 	ImGuiIO& io = ImGui::GetIO(); (void)io;
 	//io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;     // Enable Keyboard Controls
 	//io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;      // Enable Gamepad Controls
+	//io.ConfigDrawListDiff = true;                             // Only upload the parts of draw lists which changed since the previous frame
 
 	// Setup Dear ImGui style
 	ImGui::StyleColorsLight();
@@ -145,7 +146,6 @@ int main(int, char**)
 	ImVec4 clear_color = ImVec4(0.45f, 0.55f, 0.60f, 1.00f);
 	ImFont* font = io.Fonts->AddFontFromFileTTF("../res/fonts/Roboto-Medium.ttf", 16.0f);
 	unsigned int pickerTexture = loadTexture("../res/ColorPick.png");
-	unsigned int transparentTexture = loadTexture("../res//transparent.png");
 
 	// Main loop
 	while (!glfwWindowShouldClose(window))
@@ -168,7 +168,8 @@ int main(int, char**)
 		// - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application.
 		// - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application.
 		// Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
-		glfwPollEvents();
+		// ImGui_ImplGlfw_PollOrWaitEvents() calls glfwPollEvents(), or sleeps until the next input event when the last frame was idle.
+		ImGui_ImplGlfw_PollOrWaitEvents();
 
 		// Start the Dear ImGui frame
 		ImGui_ImplOpenGL3_NewFrame();
@@ -189,9 +190,11 @@ int main(int, char**)
 		g.NextItemData.ClearFlags();
 		ImGui::PushID("colorpicker");
 		ImGui::BeginGroup();
+		float backup_col[4];
+		memcpy(backup_col, col, sizeof(backup_col));
 
 		//PickerImage
-		ImGui::Image((GLuint *)pickerTexture, ImVec2(19, 19), ImVec2(0, 1), ImVec2(1, 0));
+		ImGui::Image((ImTextureID)(intptr_t)pickerTexture, ImVec2(19, 19), ImVec2(0, 1), ImVec2(1, 0));
 
 		ImVec2 picker_pos = windows->DC.CursorPos;
 		float square_sz = ImGui::GetFrameHeight();
@@ -416,6 +419,61 @@ int main(int, char**)
 		const char* items[] = { "RGB 0-255", "HSV" };
 		ImGui::Combo("combo", &combo_item_current, items, IM_ARRAYSIZE(items));
 
+		//Eyedropper (under the preview), when the renderer can read back the framebuffer
+		ImGui::SetCursorScreenPos(ImVec2(preview_pos_x, picker_pos.y + preview_size + style.ItemSpacing.y));
+		ImGui::BeginGroup();
+		ImGui::PushItemFlag(ImGuiItemFlags_NoNav, true);
+		if (io.BackendFlags & ImGuiBackendFlags_RendererHasFramebufferSampling)
+		{
+			if (ImGui::ColorPickerEyedropper(col, ImGuiColorEditFlags_None, ImVec2(preview_size * 2, 0.0f)))
+				ImGui::ColorConvertRGBtoHSV(col[0], col[1], col[2], H, S, V);
+		}
+
+		//Recent colors, 4 per row
+		const float swatch_size = ImMax(1.0f, (preview_size * 2 - style.ItemInnerSpacing.x * 3) / 4);
+		int recent_count = 0;
+		const ImVec4* recent = ImGui::GetRecentColors(&recent_count);
+		if (recent_count > 0)
+		{
+			ImGui::Text("Recent");
+			int recent_index = -1;
+			if (ImGui::ColorPalette("##recent", &recent_index, recent, recent_count, ImGuiColorEditFlags_AlphaPreviewHalf, ImVec2(swatch_size, swatch_size), 4))
+			{
+				memcpy(col, &recent[recent_index].x, sizeof(float) * 4);
+				ImGui::ColorConvertRGBtoHSV(col[0], col[1], col[2], H, S, V);
+			}
+		}
+
+		//Palette, saved in the .ini file
+		const ImVec4 col_v4(col[0], col[1], col[2], col[3]);
+		int palette_index = ImGui::FindPaletteColor(col_v4);
+		ImGui::Text("Palette");
+		ImGui::SameLine();
+		if (ImGui::SmallButton("+"))
+			ImGui::AddPaletteColor(col_v4);
+		if (palette_index >= 0)
+		{
+			ImGui::SameLine();
+			if (ImGui::SmallButton("-"))
+				ImGui::RemovePaletteColor(palette_index);
+		}
+		int palette_count = 0;
+		const ImVec4* palette = ImGui::GetPaletteColors(&palette_count);
+		if (palette_count > 0)
+		{
+			palette_index = ImGui::FindPaletteColor(col_v4);
+			const int palette_rows = ImMin((palette_count + 3) / 4, 4);
+			ImGui::BeginChild("##palette", ImVec2(preview_size * 2 + style.ScrollbarSize, palette_rows * (swatch_size + style.ItemInnerSpacing.y) - style.ItemInnerSpacing.y));
+			if (ImGui::ColorPalette("##palette", &palette_index, palette, palette_count, ImGuiColorEditFlags_AlphaPreviewHalf, ImVec2(swatch_size, swatch_size), 4))
+			{
+				memcpy(col, &palette[palette_index].x, sizeof(float) * 4);
+				ImGui::ColorConvertRGBtoHSV(col[0], col[1], col[2], H, S, V);
+			}
+			ImGui::EndChild();
+		}
+		ImGui::PopItemFlag(); // ImGuiItemFlags_NoNav
+		ImGui::EndGroup();
+
 		const int style_alpha8 = IM_F32_TO_INT8_SAT(style.Alpha);
 		const ImU32 col_black = IM_COL32(0, 0, 0, style_alpha8);
 		const ImU32 col_white = IM_COL32(255, 255, 255, style_alpha8);
@@ -510,16 +568,16 @@ int main(int, char**)
 		}
 		
 
-		ImGui::SetCursorScreenPos(ImVec2(bar_pos_x, bar_pos_y + 90));
-		ImGui::Image((GLuint *)transparentTexture, ImVec2(sv_picker_size / 3, bars_width), ImVec2(0, 1), ImVec2(1, 0));
-		ImGui::SetCursorScreenPos(ImVec2(bar_pos_x + sv_picker_size / 3, bar_pos_y + 90));
-		ImGui::Image((GLuint *)transparentTexture, ImVec2(sv_picker_size / 3, bars_width), ImVec2(0, 1), ImVec2(1, 0));
-		ImGui::SetCursorScreenPos(ImVec2(bar_pos_x + sv_picker_size * 2 / 3, bar_pos_y + 90));
-		ImGui::Image((GLuint *)transparentTexture, ImVec2(sv_picker_size / 3, bars_width), ImVec2(0, 1), ImVec2(1, 0));
+		//Checkerboard behind the alpha bar and the preview, from the font atlas: no texture of our own
+		ImGui::RenderColorRectWithAlphaCheckerboard(draw_list, bar4_bb.Min, bar4_bb.Max, 0, bars_width / 2.0f, ImVec2(0.0f, 0.0f));
+		ImGui::SetCursorScreenPos(bar4_bb.Min);
+		ImGui::Dummy(bar4_bb.GetSize());
 		draw_list->AddRectFilledMultiColor(bar4_bb.Min, bar4_bb.Max, user_col32_alpha_start, user_col32_alpha_end, user_col32_alpha_end, user_col32_alpha_start);
 		float bar_line_A = IM_ROUND(bar_pos_x + (alpha)* sv_picker_size - 3);
-		ImGui::SetCursorScreenPos(ImVec2(preview_pos_x, picker_pos.y));
-		ImGui::Image((GLuint *)transparentTexture, ImVec2(preview_size * 2, preview_size), ImVec2(0, 1), ImVec2(1, 0));
+		ImRect preview_bb(preview_pos_x, picker_pos.y, preview_pos_x + preview_size * 2, picker_pos.y + preview_size);
+		ImGui::RenderColorRectWithAlphaCheckerboard(draw_list, preview_bb.Min, preview_bb.Max, 0, preview_size / 2.99f, ImVec2(0.0f, 0.0f));
+		ImGui::SetCursorScreenPos(preview_bb.Min);
+		ImGui::Dummy(preview_bb.GetSize());
 		ImGui::RenderRectFilledRangeH(draw_list, bar5_bb, IM_COL32(255 * R, 255 * G, 255 * B, 255 * alpha), 0, 1, 0.0);
 
 		float bar_line_1 = 0;
@@ -544,6 +602,12 @@ int main(int, char**)
 		RenderRectForVerticalBar(draw_list, ImVec2(bar_line_3, bar_pos_y + 60), 22, style.Alpha);
 		RenderRectForVerticalBar(draw_list, ImVec2(bar_line_A, bar_pos_y + 90), 22, style.Alpha);
 		ImGui::EndGroup();
+		if (memcmp(backup_col, col, sizeof(backup_col)) != 0)
+			ImGui::MarkItemEdited(windows->DC.LastItemId);
+
+		//Remember the color once the user is done editing it
+		if (ImGui::IsItemDeactivatedAfterEdit())
+			ImGui::AddRecentColor(ImVec4(col[0], col[1], col[2], col[3]));
 		ImGui::PopID();
 
 
@@ -563,7 +627,6 @@ int main(int, char**)
 	ImGui_ImplGlfw_Shutdown();
 	ImGui::DestroyContext();
 	glDeleteTextures(1, &pickerTexture);
-	glDeleteTextures(1, &transparentTexture);
 	glfwDestroyWindow(window);
 	glfwTerminate();
 
@@ -15,6 +15,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-19: Misc: Added ImGui_ImplGlfw_PollOrWaitEvents() to sleep in glfwWaitEventsTimeout() while ImGui::IsFrameIdle() (GLFW 3.2+, polls otherwise).
 //  2020-01-17: Inputs: Disable error callback while assigning mouse cursors because some X11 setup don't have them and it generates errors.
 //  2019-12-05: Inputs: Added support for new mouse cursors added in GLFW 3.4+ (resizing cursors, not allowed cursor).
 //  2019-10-18: Misc: Previously installed user callbacks are now restored on shutdown.
@@ -52,6 +53,7 @@
 #define GLFW_HAS_WINDOW_ALPHA         (GLFW_VERSION_MAJOR * 1000 + GLFW_VERSION_MINOR * 100 >= 3300) // 3.3+ glfwSetWindowOpacity
 #define GLFW_HAS_PER_MONITOR_DPI      (GLFW_VERSION_MAJOR * 1000 + GLFW_VERSION_MINOR * 100 >= 3300) // 3.3+ glfwGetMonitorContentScale
 #define GLFW_HAS_VULKAN               (GLFW_VERSION_MAJOR * 1000 + GLFW_VERSION_MINOR * 100 >= 3200) // 3.2+ glfwCreateWindowSurface
+#define GLFW_HAS_WAIT_EVENTS_TIMEOUT  (GLFW_VERSION_MAJOR * 1000 + GLFW_VERSION_MINOR * 100 >= 3200) // 3.2+ glfwWaitEventsTimeout
 #ifdef GLFW_RESIZE_NESW_CURSOR  // let's be nice to people who pulled GLFW between 2019-04-16 (3.4 define) and 2019-11-29 (cursors defines) // FIXME: Remove when GLFW 3.4 is released?
 #define GLFW_HAS_NEW_CURSORS          (GLFW_VERSION_MAJOR * 1000 + GLFW_VERSION_MINOR * 100 >= 3400) // 3.4+ GLFW_RESIZE_ALL_CURSOR, GLFW_RESIZE_NESW_CURSOR, GLFW_RESIZE_NWSE_CURSOR, GLFW_NOT_ALLOWED_CURSOR
 #else
@@ -367,3 +369,26 @@ void ImGui_ImplGlfw_NewFrame()
     // Update game controllers (if enabled and available)
     ImGui_ImplGlfw_UpdateGamepads();
 }
+
+// Call instead of glfwPollEvents(), after the previous frame's ImGui::Render().
+// When the previous frame was idle, block until an event arrives or until the next timer (e.g. text cursor blink) expires.
+// Gamepads are polled and don't wake up glfwWaitEvents(), so we don't wait longer than a few frames when gamepad navigation is enabled.
+void ImGui_ImplGlfw_PollOrWaitEvents(float max_wait_time)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    float wait_time = ImGui::GetIdleWaitTime();
+    if (io.ConfigFlags & ImGuiConfigFlags_NavEnableGamepad)
+        wait_time = (wait_time < 1.0f / 30.0f) ? wait_time : 1.0f / 30.0f;
+    wait_time = (wait_time < max_wait_time) ? wait_time : max_wait_time;
+
+    if (wait_time <= 0.0f)
+        glfwPollEvents();
+    else if (wait_time == FLT_MAX)
+        glfwWaitEvents();
+    else
+#if GLFW_HAS_WAIT_EVENTS_TIMEOUT
+        glfwWaitEventsTimeout((double)wait_time);
+#else
+        glfwPollEvents();
+#endif
+}
@@ -6,6 +6,11 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
 //  [x] Renderer: Desktop GL only: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [x] Renderer: Support for per-list 16-bit or 32-bit indices (ImDrawList::IdxSize), with either ImDrawIdx.
+//  [x] Renderer: Support for index spans (ImDrawList::IdxSpans), avoiding a copy of indices when merging draw list channels.
+//  [x] Renderer: Support for dirty ranges (io.ConfigDrawListDiff), uploading only the parts of each draw list which changed since the previous frame.
+//  [x] Renderer: Support for the compact 12-byte vertex layout (IMGUI_USE_COMPACT_DRAWVERT).
+//  [x] Renderer: Desktop GL 3.2+/GL ES 3.0 only: Support for framebuffer sampling (io.WantSampleFramebuffer) with asynchronous readbacks, used by the color picker eyedropper.
 
 // You can copy and use unmodified imgui_impl_* files in your project. See main.cpp for an example of using this.
 // If you are new to dear imgui, read examples/README.txt and read the documentation at the top of imgui.cpp.
@@ -13,6 +18,11 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-19: OpenGL: Read back the region requested by io.WantSampleFramebuffer into a ring of 3 pixel buffer objects guarded by fences, enable ImGuiBackendFlags_RendererHasFramebufferSampling flag.
+//  2026-10-19: OpenGL: Keep per draw list buffers and upload ImDrawList::VtxDirtyRanges/IdxDirtyRanges with glBufferSubData() when io.ConfigDrawListDiff is enabled, enable ImGuiBackendFlags_RendererHasDirtyRanges flag.
+//  2026-10-19: OpenGL: Upload ImDrawList::IdxSpans with glBufferSubData(), enable ImGuiBackendFlags_RendererHasIdxSpans flag.
+//  2026-10-19: OpenGL: Support for IMGUI_USE_COMPACT_DRAWVERT (16-bit fixed-point positions, the 1/4 pixel scale is folded into the projection matrix).
+//  2026-10-19: OpenGL: Honor ImDrawList::IdxSize, enable ImGuiBackendFlags_RendererHasIdxSize flag.
 //  2020-04-12: OpenGL: Fixed context version check mistakenly testing for 4.0+ instead of 3.2+ to enable ImGuiBackendFlags_RendererHasVtxOffset.
 //  2020-03-24: OpenGL: Added support for glbinding 2.x OpenGL loader.
 //  2020-01-07: OpenGL: Added support for glbinding 3.x OpenGL loader.
@@ -141,6 +151,13 @@ using namespace gl;
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET   1
 #endif
 
+// Desktop GL 3.2+ and GL ES 3.0 have pixel buffer objects, glMapBufferRange() and fences, which we need for asynchronous framebuffer readbacks.
+#if defined(IMGUI_IMPL_OPENGL_ES2) || (!defined(IMGUI_IMPL_OPENGL_ES3) && !defined(GL_VERSION_3_2))
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_ASYNC_READBACK   0
+#else
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_ASYNC_READBACK   1
+#endif
+
 // OpenGL Data
 static GLuint       g_GlVersion = 0;                // Extracted at runtime using GL_MAJOR_VERSION, GL_MINOR_VERSION queries (e.g. 320 for GL 3.2)
 static char         g_GlslVersionString[32] = "";   // Specified by user or detected based on compile time GL settings.
@@ -149,6 +166,31 @@ static GLuint       g_ShaderHandle = 0, g_VertHandle = 0, g_FragHandle = 0;
 static int          g_AttribLocationTex = 0, g_AttribLocationProjMtx = 0;                                // Uniforms location
 static int          g_AttribLocationVtxPos = 0, g_AttribLocationVtxUV = 0, g_AttribLocationVtxColor = 0; // Vertex attributes location
 static unsigned int g_VboHandle = 0, g_ElementsHandle = 0;
+static int          g_FrameCount = 0;
+
+// Buffers of one draw list, kept from one frame to the next when ImDrawData::HasDirtyRanges is set, so we can upload modified ranges only.
+struct ImGui_ImplOpenGL3_ListBuffers
+{
+    const ImDrawList*   DrawList;
+    GLuint              VboHandle, ElementsHandle;
+    GLsizeiptr          VboSize, ElementsSize;  // Allocated size in bytes
+    unsigned int        Generation;             // ImDrawList::DirtyRangesGeneration of the uploaded data
+    int                 LastFrameUsed;
+};
+static ImVector<ImGui_ImplOpenGL3_ListBuffers> g_ListBuffers;
+
+#if IMGUI_IMPL_OPENGL_MAY_HAVE_ASYNC_READBACK
+// Framebuffer regions requested with io.WantSampleFramebuffer, read into a ring of pixel buffer objects: each frame starts a readback into
+// the next buffer, and buffers are only mapped once their fence is signaled (typically 1 or 2 frames later) so the CPU never waits for the GPU.
+struct ImGui_ImplOpenGL3_Readback
+{
+    GLuint              PboHandle;
+    GLsizeiptr          PboSize;                // Allocated size in bytes
+    GLsync              Fence;                  // Non-NULL while the readback is in flight
+    int                 X, Y, Width, Height;    // Region, in framebuffer pixels from the top-left
+};
+static ImGui_ImplOpenGL3_Readback g_Readbacks[3];
+#endif
 
 // Functions
 bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
@@ -170,6 +212,17 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     if (g_GlVersion >= 320)
         io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
 #endif
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasIdxSize;        // We can honor the ImDrawList::IdxSize field, allowing 32-bit indices for large lists and 16-bit indices for small lists.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasIdxSpans;       // We can honor the ImDrawList::IdxSpans field, allowing channels to be merged without copying indices.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasDirtyRanges;    // We can honor the ImDrawList::VtxDirtyRanges/IdxDirtyRanges fields, allowing partial uploads when io.ConfigDrawListDiff is enabled.
+#if IMGUI_IMPL_OPENGL_MAY_HAVE_ASYNC_READBACK
+#if defined(IMGUI_IMPL_OPENGL_ES3)
+    if (g_GlVersion >= 300)
+#else
+    if (g_GlVersion >= 320)
+#endif
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasFramebufferSampling; // We can honor io.WantSampleFramebuffer requests, enabling the color picker eyedropper.
+#endif
 
     // Store GLSL version string so we can refer to it later in case we recreate shaders.
     // Note: GLSL version is NOT the same as GL version. Leave this to NULL if unsure.
@@ -230,6 +283,21 @@ void    ImGui_ImplOpenGL3_NewFrame()
         ImGui_ImplOpenGL3_CreateDeviceObjects();
 }
 
+static void ImGui_ImplOpenGL3_SetupVertexAttribs()
+{
+    glEnableVertexAttribArray(g_AttribLocationVtxPos);
+    glEnableVertexAttribArray(g_AttribLocationVtxUV);
+    glEnableVertexAttribArray(g_AttribLocationVtxColor);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    glVertexAttribPointer(g_AttribLocationVtxPos,   2, GL_SHORT,          GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos));
+    glVertexAttribPointer(g_AttribLocationVtxUV,    2, GL_UNSIGNED_SHORT, GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv));
+#else
+    glVertexAttribPointer(g_AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos));
+    glVertexAttribPointer(g_AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv));
+#endif
+    glVertexAttribPointer(g_AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, col));
+}
+
 static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object)
 {
     // Setup render state: alpha-blending enabled, no face culling, no depth testing, scissor enabled, polygon fill
@@ -250,10 +318,15 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     float R = draw_data->DisplayPos.x + draw_data->DisplaySize.x;
     float T = draw_data->DisplayPos.y;
     float B = draw_data->DisplayPos.y + draw_data->DisplaySize.y;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const float S = 1.0f / IM_DRAWVERT_POS_SCALE;   // Fixed-point positions are fed as raw integers, scale them back to pixels here instead of in the vertex shader.
+#else
+    const float S = 1.0f;
+#endif
     const float ortho_projection[4][4] =
     {
-        { 2.0f/(R-L),   0.0f,         0.0f,   0.0f },
-        { 0.0f,         2.0f/(T-B),   0.0f,   0.0f },
+        { S*2.0f/(R-L), 0.0f,         0.0f,   0.0f },
+        { 0.0f,         S*2.0f/(T-B), 0.0f,   0.0f },
         { 0.0f,         0.0f,        -1.0f,   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
@@ -272,14 +345,206 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     // Bind vertex/index buffers and setup attributes for ImDrawVert
     glBindBuffer(GL_ARRAY_BUFFER, g_VboHandle);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, g_ElementsHandle);
-    glEnableVertexAttribArray(g_AttribLocationVtxPos);
-    glEnableVertexAttribArray(g_AttribLocationVtxUV);
-    glEnableVertexAttribArray(g_AttribLocationVtxColor);
-    glVertexAttribPointer(g_AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos));
-    glVertexAttribPointer(g_AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv));
-    glVertexAttribPointer(g_AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, col));
+    ImGui_ImplOpenGL3_SetupVertexAttribs();
+}
+
+// Upload the index stream of a draw list using IdxSpans[] to the currently bound GL_ELEMENT_ARRAY_BUFFER, which needs to be large enough.
+// With 'dirty_ranges' != NULL, only upload the parts of the spans within those byte ranges of the index stream.
+static void ImGui_ImplOpenGL3_UploadIdxSpans(const ImDrawList* cmd_list, const ImVector<ImDrawDirtyRange>* dirty_ranges)
+{
+    const GLsizeiptr idx_size = (GLsizeiptr)cmd_list->IdxSize;
+    GLintptr span_offset = 0;
+    int range_i = 0;
+    for (int span_i = 0; span_i < cmd_list->IdxSpans.Size; span_i++)
+    {
+        const ImDrawIdxSpan* span = &cmd_list->IdxSpans[span_i];
+        const char* span_data = (const char*)(span->Data ? span->Data : (const void*)cmd_list->IdxBuffer.Data) + span->Offset * idx_size;
+        const GLintptr span_end = span_offset + (GLintptr)span->Count * idx_size;
+        if (dirty_ranges == NULL)
+            glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, span_offset, span_end - span_offset, (const GLvoid*)span_data);
+        for (; dirty_ranges != NULL && range_i < dirty_ranges->Size; range_i++)
+        {
+            const GLintptr range_min = (GLintptr)(*dirty_ranges)[range_i].Offset;
+            const GLintptr range_max = range_min + (GLintptr)(*dirty_ranges)[range_i].Size;
+            const GLintptr upload_min = (range_min > span_offset) ? range_min : span_offset;
+            const GLintptr upload_max = (range_max < span_end) ? range_max : span_end;
+            if (upload_min < upload_max)
+                glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, upload_min, upload_max - upload_min, (const GLvoid*)(span_data + (upload_min - span_offset)));
+            if (range_max > span_end)
+                break; // This range continues in the next span
+        }
+        span_offset = span_end;
+    }
+}
+
+// Upload one buffer of a draw list to its persistent GL buffer: everything if the GL buffer is new/too small or doesn't hold the previous generation, otherwise the dirty ranges only.
+static void ImGui_ImplOpenGL3_UploadDirtyRanges(GLenum target, GLsizeiptr* buffer_size, bool full_upload, const void* data, GLsizeiptr data_size, const ImVector<ImDrawDirtyRange>& dirty_ranges)
+{
+    if (data_size > *buffer_size)
+    {
+        *buffer_size = data_size + data_size / 2;
+        glBufferData(target, *buffer_size, NULL, GL_DYNAMIC_DRAW);
+        full_upload = true;
+    }
+    if (data == NULL)
+        return;
+    if (full_upload)
+    {
+        glBufferSubData(target, 0, data_size, data);
+        return;
+    }
+    for (int range_i = 0; range_i < dirty_ranges.Size; range_i++)
+        glBufferSubData(target, (GLintptr)dirty_ranges[range_i].Offset, (GLsizeiptr)dirty_ranges[range_i].Size, (const GLvoid*)((const char*)data + dirty_ranges[range_i].Offset));
 }
 
+static void ImGui_ImplOpenGL3_BindListBuffers(const ImGui_ImplOpenGL3_ListBuffers* bufs)
+{
+    glBindBuffer(GL_ARRAY_BUFFER, bufs->VboHandle);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bufs->ElementsHandle);
+    ImGui_ImplOpenGL3_SetupVertexAttribs();
+}
+
+// Bind (creating if needed) the persistent buffers of a draw list and upload what changed since we last rendered it.
+static ImGui_ImplOpenGL3_ListBuffers* ImGui_ImplOpenGL3_SetupListBuffers(const ImDrawList* cmd_list)
+{
+    ImGui_ImplOpenGL3_ListBuffers* bufs = NULL;
+    for (int n = 0; n < g_ListBuffers.Size && bufs == NULL; n++)
+        if (g_ListBuffers[n].DrawList == cmd_list)
+            bufs = &g_ListBuffers[n];
+    if (bufs == NULL)
+    {
+        g_ListBuffers.resize(g_ListBuffers.Size + 1);
+        bufs = &g_ListBuffers.back();
+        memset(bufs, 0, sizeof(*bufs));
+        bufs->DrawList = cmd_list;
+        glGenBuffers(1, &bufs->VboHandle);
+        glGenBuffers(1, &bufs->ElementsHandle);
+    }
+    const bool full_upload = (bufs->LastFrameUsed == 0 || bufs->Generation + 1 != cmd_list->DirtyRangesGeneration);
+    bufs->Generation = cmd_list->DirtyRangesGeneration;
+    bufs->LastFrameUsed = g_FrameCount;
+
+    ImGui_ImplOpenGL3_BindListBuffers(bufs);
+    ImGui_ImplOpenGL3_UploadDirtyRanges(GL_ARRAY_BUFFER, &bufs->VboSize, full_upload, cmd_list->VtxBuffer.Data, (GLsizeiptr)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert), cmd_list->VtxDirtyRanges);
+    const GLsizeiptr idx_data_size = (GLsizeiptr)cmd_list->GetIdxCount() * cmd_list->IdxSize;
+    if (cmd_list->IdxSpans.Size == 0)
+    {
+        ImGui_ImplOpenGL3_UploadDirtyRanges(GL_ELEMENT_ARRAY_BUFFER, &bufs->ElementsSize, full_upload, cmd_list->IdxBuffer.Data, idx_data_size, cmd_list->IdxDirtyRanges);
+    }
+    else
+    {
+        // Grow the GL buffer if needed (which requires a full upload), then upload the dirty ranges from the spans
+        const bool idx_full_upload = full_upload || idx_data_size > bufs->ElementsSize;
+        ImGui_ImplOpenGL3_UploadDirtyRanges(GL_ELEMENT_ARRAY_BUFFER, &bufs->ElementsSize, full_upload, NULL, idx_data_size, cmd_list->IdxDirtyRanges);
+        ImGui_ImplOpenGL3_UploadIdxSpans(cmd_list, idx_full_upload ? NULL : &cmd_list->IdxDirtyRanges);
+    }
+    return bufs;
+}
+
+// Delete the persistent buffers of draw lists we didn't render this frame (or all of them).
+static void ImGui_ImplOpenGL3_DestroyListBuffers(bool only_unused)
+{
+    for (int n = 0; n < g_ListBuffers.Size; n++)
+    {
+        ImGui_ImplOpenGL3_ListBuffers* bufs = &g_ListBuffers[n];
+        if (only_unused && bufs->LastFrameUsed == g_FrameCount)
+            continue;
+        glDeleteBuffers(1, &bufs->VboHandle);
+        glDeleteBuffers(1, &bufs->ElementsHandle);
+        g_ListBuffers.erase_unsorted(bufs);
+        n--;
+    }
+}
+
+#if IMGUI_IMPL_OPENGL_MAY_HAVE_ASYNC_READBACK
+// Pass the completed readbacks to io.AddFramebufferSample(), then start reading the region requested this frame (if any) from the current read framebuffer.
+static void ImGui_ImplOpenGL3_UpdateReadbacks(int fb_width, int fb_height)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    const int ring_size = IM_ARRAYSIZE(g_Readbacks);
+    bool any_in_flight = false;
+    for (int n = 0; n < ring_size; n++)
+        any_in_flight |= (g_Readbacks[n].Fence != NULL);
+    if (!any_in_flight && !io.WantSampleFramebuffer)
+        return;
+
+    GLint last_pixel_pack_buffer; glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &last_pixel_pack_buffer);
+    GLint last_pack_row_length; glGetIntegerv(GL_PACK_ROW_LENGTH, &last_pack_row_length);
+    GLint last_pack_alignment; glGetIntegerv(GL_PACK_ALIGNMENT, &last_pack_alignment);
+
+    // Oldest first so the most recent pixels are delivered last. The oldest is the buffer we are about to reuse: drop it if still
+    // in flight rather than waiting.
+    const int write_index = g_FrameCount % ring_size;
+    for (int n = 0; n < ring_size; n++)
+    {
+        ImGui_ImplOpenGL3_Readback* rb = &g_Readbacks[(write_index + n) % ring_size];
+        if (rb->Fence == NULL)
+            continue;
+        const GLenum wait_result = glClientWaitSync(rb->Fence, 0, 0);
+        const bool complete = (wait_result == GL_ALREADY_SIGNALED || wait_result == GL_CONDITION_SATISFIED);
+        if (!complete && n > 0)
+            continue;
+        if (complete)
+        {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, rb->PboHandle);
+            const void* pixels = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)rb->Width * rb->Height * 4, GL_MAP_READ_BIT);
+            if (pixels != NULL)
+            {
+                // Rows are stored bottom-up: start from the last one with a negative stride
+                io.AddFramebufferSample(rb->X, rb->Y, rb->Width, rb->Height, (const unsigned int*)pixels + (rb->Height - 1) * rb->Width, -rb->Width);
+                glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            }
+        }
+        glDeleteSync(rb->Fence);
+        rb->Fence = NULL;
+    }
+
+    // Start reading the requested region, clipped to the framebuffer (never convert an invalid position to int)
+    const bool has_request = io.WantSampleFramebuffer && ImGui::IsMousePosValid(&io.SampleFramebufferPos);
+    const int req_x = has_request ? (int)io.SampleFramebufferPos.x : 0, req_y = has_request ? (int)io.SampleFramebufferPos.y : 0;
+    const int x0 = (req_x > 0) ? req_x : 0;
+    const int y0 = (req_y > 0) ? req_y : 0;
+    const int x1 = (req_x + io.SampleFramebufferSize < fb_width) ? req_x + io.SampleFramebufferSize : fb_width;
+    const int y1 = (req_y + io.SampleFramebufferSize < fb_height) ? req_y + io.SampleFramebufferSize : fb_height;
+    if (has_request && x1 > x0 && y1 > y0)
+    {
+        ImGui_ImplOpenGL3_Readback* rb = &g_Readbacks[write_index];
+        if (rb->PboHandle == 0)
+            glGenBuffers(1, &rb->PboHandle);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, rb->PboHandle);
+        const GLsizeiptr size = (GLsizeiptr)(x1 - x0) * (y1 - y0) * 4;
+        if (size > rb->PboSize)
+        {
+            glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+            rb->PboSize = size;
+        }
+        glPixelStorei(GL_PACK_ROW_LENGTH, 0);
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+        glReadPixels(x0, fb_height - y1, x1 - x0, y1 - y0, GL_RGBA, GL_UNSIGNED_BYTE, (GLvoid*)0);
+        rb->Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        rb->X = x0;
+        rb->Y = y0;
+        rb->Width = x1 - x0;
+        rb->Height = y1 - y0;
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, last_pixel_pack_buffer);
+    glPixelStorei(GL_PACK_ROW_LENGTH, last_pack_row_length);
+    glPixelStorei(GL_PACK_ALIGNMENT, last_pack_alignment);
+}
+
+static void ImGui_ImplOpenGL3_DestroyReadbacks()
+{
+    for (int n = 0; n < IM_ARRAYSIZE(g_Readbacks); n++)
+    {
+        ImGui_ImplOpenGL3_Readback* rb = &g_Readbacks[n];
+        if (rb->Fence)      { glDeleteSync(rb->Fence); rb->Fence = NULL; }
+        if (rb->PboHandle)  { glDeleteBuffers(1, &rb->PboHandle); rb->PboHandle = 0; }
+        rb->PboSize = 0;
+    }
+}
+#endif
+
 // OpenGL3 Render function.
 // (this used to be set in io.RenderDrawListsFn and called by ImGui::Render(), but you can now call this directly from your main loop)
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly, in order to be able to run within any OpenGL engine that doesn't do so.
@@ -339,13 +604,33 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
 
     // Render command lists
+    g_FrameCount++;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        const GLsizeiptr idx_size = (GLsizeiptr)cmd_list->IdxSize;
+        const GLenum idx_type = (idx_size == 2) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
 
         // Upload vertex/index buffers
-        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert), (const GLvoid*)cmd_list->VtxBuffer.Data, GL_STREAM_DRAW);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx), (const GLvoid*)cmd_list->IdxBuffer.Data, GL_STREAM_DRAW);
+        const ImGui_ImplOpenGL3_ListBuffers* list_bufs = NULL;
+        if (draw_data->HasDirtyRanges)
+        {
+            list_bufs = ImGui_ImplOpenGL3_SetupListBuffers(cmd_list);
+        }
+        else
+        {
+            glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert), (const GLvoid*)cmd_list->VtxBuffer.Data, GL_STREAM_DRAW);
+            if (cmd_list->IdxSpans.Size == 0)
+            {
+                glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)cmd_list->IdxBuffer.Size * idx_size, (const GLvoid*)cmd_list->IdxBuffer.Data, GL_STREAM_DRAW);
+            }
+            else
+            {
+                // Indices are scattered in multiple buffers: allocate once then upload each span in order.
+                glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)cmd_list->GetIdxCount() * idx_size, NULL, GL_STREAM_DRAW);
+                ImGui_ImplOpenGL3_UploadIdxSpans(cmd_list, NULL);
+            }
+        }
 
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
         {
@@ -355,7 +640,11 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+                    if (list_bufs != NULL)
+                        ImGui_ImplOpenGL3_BindListBuffers(list_bufs);
+                }
                 else
                     pcmd->UserCallback(cmd_list, pcmd);
             }
@@ -380,10 +669,10 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                     glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->TextureId);
 #if IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
                     if (g_GlVersion >= 320)
-                        glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset);
+                        glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, idx_type, (void*)(intptr_t)(pcmd->IdxOffset * idx_size), (GLint)pcmd->VtxOffset);
                     else
 #endif
-                    glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)));
+                    glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, idx_type, (void*)(intptr_t)(pcmd->IdxOffset * idx_size));
                 }
             }
         }
@@ -393,6 +682,13 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 #ifndef IMGUI_IMPL_OPENGL_ES2
     glDeleteVertexArrays(1, &vertex_array_object);
 #endif
+    ImGui_ImplOpenGL3_DestroyListBuffers(true);
+
+    // Eyedropper readbacks
+#if IMGUI_IMPL_OPENGL_MAY_HAVE_ASYNC_READBACK
+    if (ImGui::GetIO().BackendFlags & ImGuiBackendFlags_RendererHasFramebufferSampling)
+        ImGui_ImplOpenGL3_UpdateReadbacks(fb_width, fb_height);
+#endif
 
     // Restore modified GL state
     glUseProgram(last_program);
@@ -678,6 +974,11 @@ void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
 {
     if (g_VboHandle)        { glDeleteBuffers(1, &g_VboHandle); g_VboHandle = 0; }
     if (g_ElementsHandle)   { glDeleteBuffers(1, &g_ElementsHandle); g_ElementsHandle = 0; }
+    ImGui_ImplOpenGL3_DestroyListBuffers(false);
+    g_ListBuffers.clear();
+#if IMGUI_IMPL_OPENGL_MAY_HAVE_ASYNC_READBACK
+    ImGui_ImplOpenGL3_DestroyReadbacks();
+#endif
     if (g_ShaderHandle && g_VertHandle) { glDetachShader(g_ShaderHandle, g_VertHandle); }
     if (g_ShaderHandle && g_FragHandle) { glDetachShader(g_ShaderHandle, g_FragHandle); }
     if (g_VertHandle)       { glDeleteShader(g_VertHandle); g_VertHandle = 0; }
@@ -62,6 +62,27 @@
 // Note that stb_sprintf.h is meant to be provided by the user and available in the include path at compile time. Also, the compatibility checks of the arguments and formats done by clang and GCC will be disabled in order to support the extra formats provided by STB sprintf.
 // #define IMGUI_USE_STB_SPRINTF
 
+//---- ImHashStr()/ImHashData() (used by all ID functions) compute CRC32C, using SSE 4.2 or ARMv8 CRC32 instructions when available, or a portable implementation giving the same results.
+//#define IMGUI_DISABLE_CRC32_INTRINSICS                    // Always use the portable implementation.
+//#define IMGUI_USE_LEGACY_CRC32_HASH                       // Use the byte-at-a-time CRC32 of 1.76 and earlier instead. IDs will be the same as with those versions (e.g. ID stored in .ini files).
+
+//---- Track allocations per subsystem (windows, draw lists, font atlas, storage, settings, text edit) and display them in the Metrics window.
+// This stores a 16 bytes header in front of each allocation: memory passed to Dear ImGui for ownership (e.g. AddFontFromMemoryTTF) must come from IM_ALLOC().
+//#define IMGUI_ENABLE_MEMORY_ACCOUNTING
+
+//---- Enable scoped timers in NewFrame(), Begin(), ItemAdd(), RenderText(), EndFrame(), Render() and ImFontAtlas::Build(), shown in the Metrics window and exportable as a Chrome trace (chrome://tracing, Perfetto).
+//#define IMGUI_ENABLE_PROFILER
+//#define IMGUI_PROFILER_CAPACITY   (1 << 16)                  // Number of zones kept in the ring buffer. Must be a power of two.
+
+//---- Make the current context pointer (GImGui) thread-local, so N threads can each update their own context concurrently.
+// Contexts may share a font atlas (see CreateContext()): build it and set atlas->Locked = true before starting the threads. Contexts then never write to it.
+// The profiler (IMGUI_ENABLE_PROFILER) records each zone with the current context and its own frame number.
+// Not compatible with exporting Dear ImGui from a DLL on Windows (thread-local variables can't be exported).
+//#define IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+
+//---- Allow io.IniSaveInBackground to write the .ini file from a thread (uses std::thread, you may need to link with pthread).
+//#define IMGUI_ENABLE_SETTINGS_THREAD
+
 //---- Define constructor and implicit cast operators to convert back<>forth between your math types and ImVec2/ImVec4.
 // This will be inlined as part of ImVec2 and ImVec4 class declarations.
 /*
@@ -78,8 +99,15 @@
 // Your renderer back-end will need to support it (most example renderer back-ends support both 16/32-bit indices).
 // Another way to allow large meshes while keeping 16-bit indices is to handle ImDrawCmd::VtxOffset in your renderer.
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
+// A renderer back-end setting ImGuiBackendFlags_RendererHasIdxSize doesn't need this define: lists with 64K vertices or more are then submitted with 32-bit indices.
+// With this define and ImGuiBackendFlags_RendererHasIdxSize, lists with less than 64K vertices are still submitted as 16-bit indices.
 //#define ImDrawIdx unsigned int
 
+//---- Use a compact 12-byte ImDrawVert (16-bit fixed-point positions with 1/4 pixel precision, 16-bit normalized UV) instead of the default 20-byte one.
+// This reduces vertex memory and upload bandwidth by 40%. Your renderer back-end will need to support it (imgui_impl_opengl3.cpp does).
+// Positions are limited to the -8192..+8191 range and UV to 0..1 (no wrapping).
+//#define IMGUI_USE_COMPACT_DRAWVERT
+
 //---- Override ImDrawCallback signature (will need to modify renderer back-ends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
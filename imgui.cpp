@@ -75,6 +75,7 @@ CODE
 // [SECTION] DRAG AND DROP
 // [SECTION] LOGGING/CAPTURING
 // [SECTION] SETTINGS
+// [SECTION] PROFILER
 // [SECTION] PLATFORM DEPENDENT HELPERS
 // [SECTION] METRICS/DEBUG WINDOW
 
@@ -919,6 +920,11 @@ static ImRect           GetViewportRect();
 static void*            WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name);
 static void             WindowSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line);
 static void             WindowSettingsHandler_WriteAll(ImGuiContext*, ImGuiSettingsHandler*, ImGuiTextBuffer* buf);
+static bool             LoadIniSettingsFromBinary(ImGuiContext* ctx, const char* file_data, size_t file_data_size);
+static void             SaveIniSettingsToBinary(ImGuiContext* ctx, const char* ini_filename, const char* ini_data, size_t ini_data_size);
+static bool             SettingsWriteOrEnqueue(ImGuiContext* ctx, const char* filename, const char* data, size_t data_size, const char* mode, ImU64 expected_file_size);
+static void             SettingsWriterCollect(ImGuiContext* ctx);
+static void             SettingsWriterShutdown(ImGuiContext* ctx);
 
 // Platform Dependents default implementation for IO functions
 static const char*      GetClipboardTextFn_DefaultImpl(void* user_data);
@@ -975,11 +981,16 @@ static void             RenderWindowTitleBarContents(ImGuiWindow* window, const
 //          extern thread_local ImGuiContext* MyImGuiTLS;
 //          #define GImGui MyImGuiTLS
 //      And then define MyImGuiTLS in one of your cpp file. Note that thread_local is a C++11 keyword, earlier C++ uses compiler-specific keyword.
+//      Or simply #define IMGUI_ENABLE_THREAD_LOCAL_CONTEXT in imconfig.h, which also lets contexts share a font atlas across threads (lock it first, see imconfig.h).
 //    - Future development aim to make this context pointer explicit to all calls. Also read https://github.com/ocornut/imgui/issues/586
 //    - If you need a finite number of contexts, you may compile and use multiple instances of the ImGui code from different namespace.
 #ifndef GImGui
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+IM_THREAD_LOCAL ImGuiContext* GImGui = NULL;
+#else
 ImGuiContext*   GImGui = NULL;
 #endif
+#endif
 
 // Memory Allocator functions. Use SetAllocatorFunctions() to change them.
 // If you use DLL hotreloading you might need to call SetAllocatorFunctions() after reloading code from this file.
@@ -996,6 +1007,59 @@ static void*  (*GImAllocatorAllocFunc)(size_t size, void* user_data) = MallocWra
 static void   (*GImAllocatorFreeFunc)(void* ptr, void* user_data) = FreeWrapper;
 static void*    GImAllocatorUserData = NULL;
 
+// Memory accounting (see IMGUI_ENABLE_MEMORY_ACCOUNTING). Each allocation is prefixed with a header storing its size and tag.
+#ifdef IMGUI_ENABLE_MEMORY_ACCOUNTING
+struct ImGuiMemAllocHeader
+{
+    size_t          Size;
+    ImGuiMemTag     Tag;
+};
+#define IM_MEMALLOC_HEADER_SIZE     16      // Preserve the alignment of the allocator
+IM_STATIC_ASSERT(sizeof(ImGuiMemAllocHeader) <= IM_MEMALLOC_HEADER_SIZE);
+
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+IM_THREAD_LOCAL ImGuiMemTag GImMemTag = ImGuiMemTag_Misc;
+#else
+ImGuiMemTag         GImMemTag = ImGuiMemTag_Misc;
+#endif
+ImGuiMemTagStats    GImMemTagStats[ImGuiMemTag_COUNT] = {};
+
+// GImMemTagStats[] is shared by all contexts, which may be used from several threads: its fields are only accessed with
+// relaxed atomic operations (they are independent counters, nothing is published through them).
+#if defined(_MSC_VER)
+#include <intrin.h>         // _InterlockedXXX
+static inline void   MemTagStatsAdd(volatile int* p, int v)                         { _InterlockedExchangeAdd((volatile long*)p, (long)v); }
+static inline int    MemTagStatsLoad(volatile int* p)                               { return (int)_InterlockedCompareExchange((volatile long*)p, 0, 0); }
+#ifdef _WIN64
+static inline size_t MemTagStatsAdd(volatile size_t* p, size_t v)                   { return (size_t)_InterlockedExchangeAdd64((volatile __int64*)p, (__int64)v) + v; }
+static inline size_t MemTagStatsLoad(volatile size_t* p)                            { return (size_t)_InterlockedCompareExchange64((volatile __int64*)p, 0, 0); }
+static inline size_t MemTagStatsCompareExchange(volatile size_t* p, size_t cmp, size_t v) { return (size_t)_InterlockedCompareExchange64((volatile __int64*)p, (__int64)v, (__int64)cmp); }
+#else
+static inline size_t MemTagStatsAdd(volatile size_t* p, size_t v)                   { return (size_t)_InterlockedExchangeAdd((volatile long*)p, (long)v) + v; }
+static inline size_t MemTagStatsLoad(volatile size_t* p)                            { return (size_t)_InterlockedCompareExchange((volatile long*)p, 0, 0); }
+static inline size_t MemTagStatsCompareExchange(volatile size_t* p, size_t cmp, size_t v) { return (size_t)_InterlockedCompareExchange((volatile long*)p, (long)v, (long)cmp); }
+#endif
+#else
+static inline void   MemTagStatsAdd(volatile int* p, int v)                         { __atomic_add_fetch(p, v, __ATOMIC_RELAXED); }
+static inline int    MemTagStatsLoad(volatile int* p)                               { return __atomic_load_n(p, __ATOMIC_RELAXED); }
+static inline size_t MemTagStatsAdd(volatile size_t* p, size_t v)                   { return __atomic_add_fetch(p, v, __ATOMIC_RELAXED); }
+static inline size_t MemTagStatsLoad(volatile size_t* p)                            { return __atomic_load_n(p, __ATOMIC_RELAXED); }
+static inline size_t MemTagStatsCompareExchange(volatile size_t* p, size_t cmp, size_t v) { __atomic_compare_exchange_n(p, &cmp, v, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED); return cmp; }
+#endif
+
+static inline void MemTagStatsMax(volatile size_t* p, size_t v)
+{
+    size_t prev = MemTagStatsLoad(p);
+    while (prev < v)
+    {
+        const size_t seen = MemTagStatsCompareExchange(p, prev, v);
+        if (seen == prev)
+            break;
+        prev = seen;
+    }
+}
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] USER FACING STRUCTURES (ImGuiStyle, ImGuiIO)
 //-----------------------------------------------------------------------------
@@ -1081,6 +1145,8 @@ ImGuiIO::ImGuiIO()
     DeltaTime = 1.0f/60.0f;
     IniSavingRate = 5.0f;
     IniFilename = "imgui.ini";
+    IniBinaryFormat = false;
+    IniSaveInBackground = false;
     LogFilename = "imgui_log.txt";
     MouseDoubleClickTime = 0.30f;
     MouseDoubleClickMaxDist = 6.0f;
@@ -1107,6 +1173,7 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigWindowsMemoryCompactTimer = 60.0f;
+    ConfigDrawListDiff = false;
 
     // Platform Functions
     BackendPlatformName = BackendRendererName = NULL;
@@ -1180,6 +1247,26 @@ void ImGuiIO::ClearInputCharacters()
     InputQueueCharacters.resize(0);
 }
 
+// Keep the requested region if it is covered by the provided pixels (e.g. a whole software-rendered framebuffer),
+// otherwise the closest one: asynchronous readbacks are a few frames late and the mouse may have moved since.
+void ImGuiIO::AddFramebufferSample(int x, int y, int width, int height, const unsigned int* pixels, int pixels_stride)
+{
+    const int size = SampleFramebufferSize;
+    if (!WantSampleFramebuffer || !ImGui::IsMousePosValid(&SampleFramebufferPos) || size <= 0 || width <= 0 || height <= 0)
+        return;
+    const int sample_x = ImClamp((int)SampleFramebufferPos.x, x, ImMax(x, x + width - size));
+    const int sample_y = ImClamp((int)SampleFramebufferPos.y, y, ImMax(y, y + height - size));
+    FramebufferSamplePixels.resize(size * size);
+    for (int row = 0; row < size; row++)
+        for (int column = 0; column < size; column++)
+        {
+            const int px = sample_x + column - x, py = sample_y + row - y; // Always >= 0
+            FramebufferSamplePixels[row * size + column] = (px < width && py < height) ? pixels[py * pixels_stride + px] : 0;
+        }
+    FramebufferSamplePos = ImVec2((float)sample_x, (float)sample_y);
+    FramebufferSampleSize = ImVec2((float)ImMin(size, x + width - sample_x), (float)ImMin(size, y + height - sample_y));
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (Geometry functions)
 //-----------------------------------------------------------------------------
@@ -1422,6 +1509,152 @@ const char* ImStrSkipBlank(const char* str)
     return str;
 }
 
+// Cheaper than sscanf("%d"). Doesn't check for overflow.
+const char* ImStrParseInt(const char* str, int* out_value)
+{
+    str = ImStrSkipBlank(str);
+    const bool negative = (str[0] == '-');
+    if (str[0] == '-' || str[0] == '+')
+        str++;
+    if (str[0] < '0' || str[0] > '9')
+        return NULL;
+    unsigned int v = 0;
+    while (str[0] >= '0' && str[0] <= '9')
+        v = v * 10 + (unsigned int)(*str++ - '0');
+    *out_value = negative ? -(int)v : (int)v;
+    return str;
+}
+
+// Cheaper than sscanf("%02X"). Parse up to 'max_digits' hexadecimal digits, return the end of the number or NULL if there is none.
+const char* ImStrParseHex(const char* str, int max_digits, unsigned int* out_value)
+{
+    unsigned int v = 0;
+    int digits = 0;
+    for (; digits < max_digits; digits++, str++)
+    {
+        const char c = *str;
+        if (c >= '0' && c <= '9')      v = (v << 4) + (unsigned int)(c - '0');
+        else if (c >= 'A' && c <= 'F') v = (v << 4) + (unsigned int)(c - 'A' + 10);
+        else if (c >= 'a' && c <= 'f') v = (v << 4) + (unsigned int)(c - 'a' + 10);
+        else break;
+    }
+    if (digits == 0)
+        return NULL;
+    *out_value = v;
+    return str;
+}
+
+static const char GDecimalDigitPairs[201] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+static inline char* ImStrAppendClamped(char* dst, char* dst_end, const char* src, const char* src_end)
+{
+    const size_t len = ImMin((size_t)(src_end - src), (size_t)(dst_end - dst));
+    memcpy(dst, src, len);
+    return dst + len;
+}
+
+// Cheaper than ImFormatString() for a format holding a single integer specifier: %d, %i, %u, %x or %X, with optional '-' or '0' flags and width,
+// and 'll' or 'I64' length for 64-bit values (e.g. "%d", "R:%3d", "%08X", "%lld items"). Decimal digits are written two at a time from a table.
+// 'v' holds the value as passed to printf(): 32-bit (promoted to int for smaller types) unless 'v_is_64bit'.
+// Return -1 if the format isn't supported (precision, other flags, '%' in decorations...), in which case use ImFormatString().
+int ImFormatStringInt(char* buf, size_t buf_size, const char* fmt, ImU64 v, bool v_is_64bit)
+{
+    IM_ASSERT(buf != NULL && buf_size > 0);
+    const char* fmt_start = fmt;
+    while (*fmt_start != '%')
+        if (*fmt_start++ == 0)
+            return -1;
+    const char* p = fmt_start + 1;
+    bool left_align = false, zero_pad = false;
+    for (;; p++)
+    {
+        if (*p == '-')      left_align = true;
+        else if (*p == '0') zero_pad = true;
+        else break;
+    }
+    int width = 0;
+    while (*p >= '0' && *p <= '9' && width < 1000)
+        width = width * 10 + (*p++ - '0');
+    if (width > 64)
+        return -1;
+    bool is_64bit = false;
+    if (p[0] == 'l' && p[1] == 'l')                     { is_64bit = true; p += 2; }
+    else if (p[0] == 'I' && p[1] == '6' && p[2] == '4') { is_64bit = true; p += 3; }
+    const char type = *p++;
+    if (is_64bit != v_is_64bit || (type != 'd' && type != 'i' && type != 'u' && type != 'x' && type != 'X'))
+        return -1;
+    const char* fmt_suffix = p;
+    while (*p)
+        if (*p++ == '%')
+            return -1;
+
+    // Write digits backward
+    char num[96];
+    char* num_end = num + IM_ARRAYSIZE(num);
+    char* d = num_end;
+    ImU64 u = v_is_64bit ? v : (ImU64)(ImU32)v;
+    bool negative = false;
+    if (type == 'd' || type == 'i')
+    {
+        const ImS64 s = v_is_64bit ? (ImS64)v : (ImS64)(ImS32)(ImU32)v;
+        negative = (s < 0);
+        u = negative ? (ImU64)0 - (ImU64)s : (ImU64)s;
+    }
+    if (type == 'x' || type == 'X')
+    {
+        const char* hex_digits = (type == 'x') ? "0123456789abcdef" : "0123456789ABCDEF";
+        do { *--d = hex_digits[u & 15]; u >>= 4; } while (u != 0);
+    }
+    else
+    {
+        while (u >= 100)
+        {
+            const ImU64 q = u / 100;
+            const char* pair = &GDecimalDigitPairs[(u - q * 100) * 2];
+            *--d = pair[1];
+            *--d = pair[0];
+            u = q;
+        }
+        if (u >= 10) { *--d = GDecimalDigitPairs[u * 2 + 1]; *--d = GDecimalDigitPairs[u * 2]; }
+        else         { *--d = (char)('0' + u); }
+    }
+
+    // Sign and padding
+    const int pad = ImMax(width - (int)(num_end - d) - (negative ? 1 : 0), 0);
+    if (left_align)
+    {
+        if (negative)
+            *--d = '-';
+        memmove(d - pad, d, (size_t)(num_end - d));
+        memset(num_end - pad, ' ', (size_t)pad);
+        d -= pad;
+    }
+    else
+    {
+        if (zero_pad)
+            for (int n = 0; n < pad; n++)
+                *--d = '0';
+        if (negative)
+            *--d = '-';
+        if (!zero_pad)
+            for (int n = 0; n < pad; n++)
+                *--d = ' ';
+    }
+
+    char* out = buf;
+    char* out_end = buf + buf_size - 1;
+    out = ImStrAppendClamped(out, out_end, fmt, fmt_start);
+    out = ImStrAppendClamped(out, out_end, d, num_end);
+    out = ImStrAppendClamped(out, out_end, fmt_suffix, p);
+    *out = 0;
+    return (int)(out - buf);
+}
+
 // A) MSVC version appears to return -1 on overflow, whereas glibc appears to return total count (which may be >= buf_size).
 // Ideally we would test for only one of those limits at runtime depending on the behavior the vsnprintf(), but trying to deduct it at compile time sounds like a pandora can of worm.
 // B) When buf==NULL vsnprintf() will return the output size.
@@ -1474,6 +1707,289 @@ int ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args)
 }
 #endif // #ifdef IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS
 
+// We hash IDs with CRC32C (Castagnoli polynomial), using the dedicated CPU instructions when available:
+// - x86-64: SSE 4.2 _mm_crc32_u64(). Used directly when compiling with SSE 4.2 enabled, otherwise selected at runtime after checking CPUID.
+// - ARM: ARMv8 __crc32cd(), when compiling with the CRC extension enabled (e.g. -march=armv8-a+crc, default on Apple Silicon).
+// - Otherwise: portable "slice-by-8" implementation, processing 8 bytes per iteration using 8KB of lookup tables.
+// All paths return the same values, so IDs (e.g. stored in .ini files) are the same on every machine.
+// '#define IMGUI_DISABLE_CRC32_INTRINSICS' to always use the portable path.
+// '#define IMGUI_USE_LEGACY_CRC32_HASH' to use the byte-at-a-time CRC32 of Dear ImGui 1.76 and earlier, which produces different IDs.
+#ifndef IMGUI_USE_LEGACY_CRC32_HASH
+
+#ifndef IMGUI_DISABLE_CRC32_INTRINSICS
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define IMGUI_CRC32C_ARM
+#elif (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+#include <nmmintrin.h>
+#define IMGUI_CRC32C_SSE42
+#if !defined(__SSE4_2__)
+#define IMGUI_CRC32C_SSE42_RUNTIME_CHECK
+#if defined(_MSC_VER)
+#include <intrin.h>     // __cpuid
+#endif
+#endif
+#endif
+#endif // #ifndef IMGUI_DISABLE_CRC32_INTRINSICS
+
+// Although the code to generate the tables is simple and shorter than the tables themselves, using const tables allows us to easily:
+// - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
+// GCrc32cLookupTable[0] is the regular byte-at-a-time table, GCrc32cLookupTable[n] advances a byte by n extra zero bytes.
+static const ImU32 GCrc32cLookupTable[8][256] =
+{
+    {
+        0x00000000,0xF26B8303,0xE13B70F7,0x1350F3F4,0xC79A971F,0x35F1141C,0x26A1E7E8,0xD4CA64EB,0x8AD958CF,0x78B2DBCC,0x6BE22838,0x9989AB3B,0x4D43CFD0,0xBF284CD3,0xAC78BF27,0x5E133C24,
+        0x105EC76F,0xE235446C,0xF165B798,0x030E349B,0xD7C45070,0x25AFD373,0x36FF2087,0xC494A384,0x9A879FA0,0x68EC1CA3,0x7BBCEF57,0x89D76C54,0x5D1D08BF,0xAF768BBC,0xBC267848,0x4E4DFB4B,
+        0x20BD8EDE,0xD2D60DDD,0xC186FE29,0x33ED7D2A,0xE72719C1,0x154C9AC2,0x061C6936,0xF477EA35,0xAA64D611,0x580F5512,0x4B5FA6E6,0xB93425E5,0x6DFE410E,0x9F95C20D,0x8CC531F9,0x7EAEB2FA,
+        0x30E349B1,0xC288CAB2,0xD1D83946,0x23B3BA45,0xF779DEAE,0x05125DAD,0x1642AE59,0xE4292D5A,0xBA3A117E,0x4851927D,0x5B016189,0xA96AE28A,0x7DA08661,0x8FCB0562,0x9C9BF696,0x6EF07595,
+        0x417B1DBC,0xB3109EBF,0xA0406D4B,0x522BEE48,0x86E18AA3,0x748A09A0,0x67DAFA54,0x95B17957,0xCBA24573,0x39C9C670,0x2A993584,0xD8F2B687,0x0C38D26C,0xFE53516F,0xED03A29B,0x1F682198,
+        0x5125DAD3,0xA34E59D0,0xB01EAA24,0x42752927,0x96BF4DCC,0x64D4CECF,0x77843D3B,0x85EFBE38,0xDBFC821C,0x2997011F,0x3AC7F2EB,0xC8AC71E8,0x1C661503,0xEE0D9600,0xFD5D65F4,0x0F36E6F7,
+        0x61C69362,0x93AD1061,0x80FDE395,0x72966096,0xA65C047D,0x5437877E,0x4767748A,0xB50CF789,0xEB1FCBAD,0x197448AE,0x0A24BB5A,0xF84F3859,0x2C855CB2,0xDEEEDFB1,0xCDBE2C45,0x3FD5AF46,
+        0x7198540D,0x83F3D70E,0x90A324FA,0x62C8A7F9,0xB602C312,0x44694011,0x5739B3E5,0xA55230E6,0xFB410CC2,0x092A8FC1,0x1A7A7C35,0xE811FF36,0x3CDB9BDD,0xCEB018DE,0xDDE0EB2A,0x2F8B6829,
+        0x82F63B78,0x709DB87B,0x63CD4B8F,0x91A6C88C,0x456CAC67,0xB7072F64,0xA457DC90,0x563C5F93,0x082F63B7,0xFA44E0B4,0xE9141340,0x1B7F9043,0xCFB5F4A8,0x3DDE77AB,0x2E8E845F,0xDCE5075C,
+        0x92A8FC17,0x60C37F14,0x73938CE0,0x81F80FE3,0x55326B08,0xA759E80B,0xB4091BFF,0x466298FC,0x1871A4D8,0xEA1A27DB,0xF94AD42F,0x0B21572C,0xDFEB33C7,0x2D80B0C4,0x3ED04330,0xCCBBC033,
+        0xA24BB5A6,0x502036A5,0x4370C551,0xB11B4652,0x65D122B9,0x97BAA1BA,0x84EA524E,0x7681D14D,0x2892ED69,0xDAF96E6A,0xC9A99D9E,0x3BC21E9D,0xEF087A76,0x1D63F975,0x0E330A81,0xFC588982,
+        0xB21572C9,0x407EF1CA,0x532E023E,0xA145813D,0x758FE5D6,0x87E466D5,0x94B49521,0x66DF1622,0x38CC2A06,0xCAA7A905,0xD9F75AF1,0x2B9CD9F2,0xFF56BD19,0x0D3D3E1A,0x1E6DCDEE,0xEC064EED,
+        0xC38D26C4,0x31E6A5C7,0x22B65633,0xD0DDD530,0x0417B1DB,0xF67C32D8,0xE52CC12C,0x1747422F,0x49547E0B,0xBB3FFD08,0xA86F0EFC,0x5A048DFF,0x8ECEE914,0x7CA56A17,0x6FF599E3,0x9D9E1AE0,
+        0xD3D3E1AB,0x21B862A8,0x32E8915C,0xC083125F,0x144976B4,0xE622F5B7,0xF5720643,0x07198540,0x590AB964,0xAB613A67,0xB831C993,0x4A5A4A90,0x9E902E7B,0x6CFBAD78,0x7FAB5E8C,0x8DC0DD8F,
+        0xE330A81A,0x115B2B19,0x020BD8ED,0xF0605BEE,0x24AA3F05,0xD6C1BC06,0xC5914FF2,0x37FACCF1,0x69E9F0D5,0x9B8273D6,0x88D28022,0x7AB90321,0xAE7367CA,0x5C18E4C9,0x4F48173D,0xBD23943E,
+        0xF36E6F75,0x0105EC76,0x12551F82,0xE03E9C81,0x34F4F86A,0xC69F7B69,0xD5CF889D,0x27A40B9E,0x79B737BA,0x8BDCB4B9,0x988C474D,0x6AE7C44E,0xBE2DA0A5,0x4C4623A6,0x5F16D052,0xAD7D5351,
+    },
+    {
+        0x00000000,0x13A29877,0x274530EE,0x34E7A899,0x4E8A61DC,0x5D28F9AB,0x69CF5132,0x7A6DC945,0x9D14C3B8,0x8EB65BCF,0xBA51F356,0xA9F36B21,0xD39EA264,0xC03C3A13,0xF4DB928A,0xE7790AFD,
+        0x3FC5F181,0x2C6769F6,0x1880C16F,0x0B225918,0x714F905D,0x62ED082A,0x560AA0B3,0x45A838C4,0xA2D13239,0xB173AA4E,0x859402D7,0x96369AA0,0xEC5B53E5,0xFFF9CB92,0xCB1E630B,0xD8BCFB7C,
+        0x7F8BE302,0x6C297B75,0x58CED3EC,0x4B6C4B9B,0x310182DE,0x22A31AA9,0x1644B230,0x05E62A47,0xE29F20BA,0xF13DB8CD,0xC5DA1054,0xD6788823,0xAC154166,0xBFB7D911,0x8B507188,0x98F2E9FF,
+        0x404E1283,0x53EC8AF4,0x670B226D,0x74A9BA1A,0x0EC4735F,0x1D66EB28,0x298143B1,0x3A23DBC6,0xDD5AD13B,0xCEF8494C,0xFA1FE1D5,0xE9BD79A2,0x93D0B0E7,0x80722890,0xB4958009,0xA737187E,
+        0xFF17C604,0xECB55E73,0xD852F6EA,0xCBF06E9D,0xB19DA7D8,0xA23F3FAF,0x96D89736,0x857A0F41,0x620305BC,0x71A19DCB,0x45463552,0x56E4AD25,0x2C896460,0x3F2BFC17,0x0BCC548E,0x186ECCF9,
+        0xC0D23785,0xD370AFF2,0xE797076B,0xF4359F1C,0x8E585659,0x9DFACE2E,0xA91D66B7,0xBABFFEC0,0x5DC6F43D,0x4E646C4A,0x7A83C4D3,0x69215CA4,0x134C95E1,0x00EE0D96,0x3409A50F,0x27AB3D78,
+        0x809C2506,0x933EBD71,0xA7D915E8,0xB47B8D9F,0xCE1644DA,0xDDB4DCAD,0xE9537434,0xFAF1EC43,0x1D88E6BE,0x0E2A7EC9,0x3ACDD650,0x296F4E27,0x53028762,0x40A01F15,0x7447B78C,0x67E52FFB,
+        0xBF59D487,0xACFB4CF0,0x981CE469,0x8BBE7C1E,0xF1D3B55B,0xE2712D2C,0xD69685B5,0xC5341DC2,0x224D173F,0x31EF8F48,0x050827D1,0x16AABFA6,0x6CC776E3,0x7F65EE94,0x4B82460D,0x5820DE7A,
+        0xFBC3FAF9,0xE861628E,0xDC86CA17,0xCF245260,0xB5499B25,0xA6EB0352,0x920CABCB,0x81AE33BC,0x66D73941,0x7575A136,0x419209AF,0x523091D8,0x285D589D,0x3BFFC0EA,0x0F186873,0x1CBAF004,
+        0xC4060B78,0xD7A4930F,0xE3433B96,0xF0E1A3E1,0x8A8C6AA4,0x992EF2D3,0xADC95A4A,0xBE6BC23D,0x5912C8C0,0x4AB050B7,0x7E57F82E,0x6DF56059,0x1798A91C,0x043A316B,0x30DD99F2,0x237F0185,
+        0x844819FB,0x97EA818C,0xA30D2915,0xB0AFB162,0xCAC27827,0xD960E050,0xED8748C9,0xFE25D0BE,0x195CDA43,0x0AFE4234,0x3E19EAAD,0x2DBB72DA,0x57D6BB9F,0x447423E8,0x70938B71,0x63311306,
+        0xBB8DE87A,0xA82F700D,0x9CC8D894,0x8F6A40E3,0xF50789A6,0xE6A511D1,0xD242B948,0xC1E0213F,0x26992BC2,0x353BB3B5,0x01DC1B2C,0x127E835B,0x68134A1E,0x7BB1D269,0x4F567AF0,0x5CF4E287,
+        0x04D43CFD,0x1776A48A,0x23910C13,0x30339464,0x4A5E5D21,0x59FCC556,0x6D1B6DCF,0x7EB9F5B8,0x99C0FF45,0x8A626732,0xBE85CFAB,0xAD2757DC,0xD74A9E99,0xC4E806EE,0xF00FAE77,0xE3AD3600,
+        0x3B11CD7C,0x28B3550B,0x1C54FD92,0x0FF665E5,0x759BACA0,0x663934D7,0x52DE9C4E,0x417C0439,0xA6050EC4,0xB5A796B3,0x81403E2A,0x92E2A65D,0xE88F6F18,0xFB2DF76F,0xCFCA5FF6,0xDC68C781,
+        0x7B5FDFFF,0x68FD4788,0x5C1AEF11,0x4FB87766,0x35D5BE23,0x26772654,0x12908ECD,0x013216BA,0xE64B1C47,0xF5E98430,0xC10E2CA9,0xD2ACB4DE,0xA8C17D9B,0xBB63E5EC,0x8F844D75,0x9C26D502,
+        0x449A2E7E,0x5738B609,0x63DF1E90,0x707D86E7,0x0A104FA2,0x19B2D7D5,0x2D557F4C,0x3EF7E73B,0xD98EEDC6,0xCA2C75B1,0xFECBDD28,0xED69455F,0x97048C1A,0x84A6146D,0xB041BCF4,0xA3E32483,
+    },
+    {
+        0x00000000,0xA541927E,0x4F6F520D,0xEA2EC073,0x9EDEA41A,0x3B9F3664,0xD1B1F617,0x74F06469,0x38513EC5,0x9D10ACBB,0x773E6CC8,0xD27FFEB6,0xA68F9ADF,0x03CE08A1,0xE9E0C8D2,0x4CA15AAC,
+        0x70A27D8A,0xD5E3EFF4,0x3FCD2F87,0x9A8CBDF9,0xEE7CD990,0x4B3D4BEE,0xA1138B9D,0x045219E3,0x48F3434F,0xEDB2D131,0x079C1142,0xA2DD833C,0xD62DE755,0x736C752B,0x9942B558,0x3C032726,
+        0xE144FB14,0x4405696A,0xAE2BA919,0x0B6A3B67,0x7F9A5F0E,0xDADBCD70,0x30F50D03,0x95B49F7D,0xD915C5D1,0x7C5457AF,0x967A97DC,0x333B05A2,0x47CB61CB,0xE28AF3B5,0x08A433C6,0xADE5A1B8,
+        0x91E6869E,0x34A714E0,0xDE89D493,0x7BC846ED,0x0F382284,0xAA79B0FA,0x40577089,0xE516E2F7,0xA9B7B85B,0x0CF62A25,0xE6D8EA56,0x43997828,0x37691C41,0x92288E3F,0x78064E4C,0xDD47DC32,
+        0xC76580D9,0x622412A7,0x880AD2D4,0x2D4B40AA,0x59BB24C3,0xFCFAB6BD,0x16D476CE,0xB395E4B0,0xFF34BE1C,0x5A752C62,0xB05BEC11,0x151A7E6F,0x61EA1A06,0xC4AB8878,0x2E85480B,0x8BC4DA75,
+        0xB7C7FD53,0x12866F2D,0xF8A8AF5E,0x5DE93D20,0x29195949,0x8C58CB37,0x66760B44,0xC337993A,0x8F96C396,0x2AD751E8,0xC0F9919B,0x65B803E5,0x1148678C,0xB409F5F2,0x5E273581,0xFB66A7FF,
+        0x26217BCD,0x8360E9B3,0x694E29C0,0xCC0FBBBE,0xB8FFDFD7,0x1DBE4DA9,0xF7908DDA,0x52D11FA4,0x1E704508,0xBB31D776,0x511F1705,0xF45E857B,0x80AEE112,0x25EF736C,0xCFC1B31F,0x6A802161,
+        0x56830647,0xF3C29439,0x19EC544A,0xBCADC634,0xC85DA25D,0x6D1C3023,0x8732F050,0x2273622E,0x6ED23882,0xCB93AAFC,0x21BD6A8F,0x84FCF8F1,0xF00C9C98,0x554D0EE6,0xBF63CE95,0x1A225CEB,
+        0x8B277743,0x2E66E53D,0xC448254E,0x6109B730,0x15F9D359,0xB0B84127,0x5A968154,0xFFD7132A,0xB3764986,0x1637DBF8,0xFC191B8B,0x595889F5,0x2DA8ED9C,0x88E97FE2,0x62C7BF91,0xC7862DEF,
+        0xFB850AC9,0x5EC498B7,0xB4EA58C4,0x11ABCABA,0x655BAED3,0xC01A3CAD,0x2A34FCDE,0x8F756EA0,0xC3D4340C,0x6695A672,0x8CBB6601,0x29FAF47F,0x5D0A9016,0xF84B0268,0x1265C21B,0xB7245065,
+        0x6A638C57,0xCF221E29,0x250CDE5A,0x804D4C24,0xF4BD284D,0x51FCBA33,0xBBD27A40,0x1E93E83E,0x5232B292,0xF77320EC,0x1D5DE09F,0xB81C72E1,0xCCEC1688,0x69AD84F6,0x83834485,0x26C2D6FB,
+        0x1AC1F1DD,0xBF8063A3,0x55AEA3D0,0xF0EF31AE,0x841F55C7,0x215EC7B9,0xCB7007CA,0x6E3195B4,0x2290CF18,0x87D15D66,0x6DFF9D15,0xC8BE0F6B,0xBC4E6B02,0x190FF97C,0xF321390F,0x5660AB71,
+        0x4C42F79A,0xE90365E4,0x032DA597,0xA66C37E9,0xD29C5380,0x77DDC1FE,0x9DF3018D,0x38B293F3,0x7413C95F,0xD1525B21,0x3B7C9B52,0x9E3D092C,0xEACD6D45,0x4F8CFF3B,0xA5A23F48,0x00E3AD36,
+        0x3CE08A10,0x99A1186E,0x738FD81D,0xD6CE4A63,0xA23E2E0A,0x077FBC74,0xED517C07,0x4810EE79,0x04B1B4D5,0xA1F026AB,0x4BDEE6D8,0xEE9F74A6,0x9A6F10CF,0x3F2E82B1,0xD50042C2,0x7041D0BC,
+        0xAD060C8E,0x08479EF0,0xE2695E83,0x4728CCFD,0x33D8A894,0x96993AEA,0x7CB7FA99,0xD9F668E7,0x9557324B,0x3016A035,0xDA386046,0x7F79F238,0x0B899651,0xAEC8042F,0x44E6C45C,0xE1A75622,
+        0xDDA47104,0x78E5E37A,0x92CB2309,0x378AB177,0x437AD51E,0xE63B4760,0x0C158713,0xA954156D,0xE5F54FC1,0x40B4DDBF,0xAA9A1DCC,0x0FDB8FB2,0x7B2BEBDB,0xDE6A79A5,0x3444B9D6,0x91052BA8,
+    },
+    {
+        0x00000000,0xDD45AAB8,0xBF672381,0x62228939,0x7B2231F3,0xA6679B4B,0xC4451272,0x1900B8CA,0xF64463E6,0x2B01C95E,0x49234067,0x9466EADF,0x8D665215,0x5023F8AD,0x32017194,0xEF44DB2C,
+        0xE964B13D,0x34211B85,0x560392BC,0x8B463804,0x924680CE,0x4F032A76,0x2D21A34F,0xF06409F7,0x1F20D2DB,0xC2657863,0xA047F15A,0x7D025BE2,0x6402E328,0xB9474990,0xDB65C0A9,0x06206A11,
+        0xD725148B,0x0A60BE33,0x6842370A,0xB5079DB2,0xAC072578,0x71428FC0,0x136006F9,0xCE25AC41,0x2161776D,0xFC24DDD5,0x9E0654EC,0x4343FE54,0x5A43469E,0x8706EC26,0xE524651F,0x3861CFA7,
+        0x3E41A5B6,0xE3040F0E,0x81268637,0x5C632C8F,0x45639445,0x98263EFD,0xFA04B7C4,0x27411D7C,0xC805C650,0x15406CE8,0x7762E5D1,0xAA274F69,0xB327F7A3,0x6E625D1B,0x0C40D422,0xD1057E9A,
+        0xABA65FE7,0x76E3F55F,0x14C17C66,0xC984D6DE,0xD0846E14,0x0DC1C4AC,0x6FE34D95,0xB2A6E72D,0x5DE23C01,0x80A796B9,0xE2851F80,0x3FC0B538,0x26C00DF2,0xFB85A74A,0x99A72E73,0x44E284CB,
+        0x42C2EEDA,0x9F874462,0xFDA5CD5B,0x20E067E3,0x39E0DF29,0xE4A57591,0x8687FCA8,0x5BC25610,0xB4868D3C,0x69C32784,0x0BE1AEBD,0xD6A40405,0xCFA4BCCF,0x12E11677,0x70C39F4E,0xAD8635F6,
+        0x7C834B6C,0xA1C6E1D4,0xC3E468ED,0x1EA1C255,0x07A17A9F,0xDAE4D027,0xB8C6591E,0x6583F3A6,0x8AC7288A,0x57828232,0x35A00B0B,0xE8E5A1B3,0xF1E51979,0x2CA0B3C1,0x4E823AF8,0x93C79040,
+        0x95E7FA51,0x48A250E9,0x2A80D9D0,0xF7C57368,0xEEC5CBA2,0x3380611A,0x51A2E823,0x8CE7429B,0x63A399B7,0xBEE6330F,0xDCC4BA36,0x0181108E,0x1881A844,0xC5C402FC,0xA7E68BC5,0x7AA3217D,
+        0x52A0C93F,0x8FE56387,0xEDC7EABE,0x30824006,0x2982F8CC,0xF4C75274,0x96E5DB4D,0x4BA071F5,0xA4E4AAD9,0x79A10061,0x1B838958,0xC6C623E0,0xDFC69B2A,0x02833192,0x60A1B8AB,0xBDE41213,
+        0xBBC47802,0x6681D2BA,0x04A35B83,0xD9E6F13B,0xC0E649F1,0x1DA3E349,0x7F816A70,0xA2C4C0C8,0x4D801BE4,0x90C5B15C,0xF2E73865,0x2FA292DD,0x36A22A17,0xEBE780AF,0x89C50996,0x5480A32E,
+        0x8585DDB4,0x58C0770C,0x3AE2FE35,0xE7A7548D,0xFEA7EC47,0x23E246FF,0x41C0CFC6,0x9C85657E,0x73C1BE52,0xAE8414EA,0xCCA69DD3,0x11E3376B,0x08E38FA1,0xD5A62519,0xB784AC20,0x6AC10698,
+        0x6CE16C89,0xB1A4C631,0xD3864F08,0x0EC3E5B0,0x17C35D7A,0xCA86F7C2,0xA8A47EFB,0x75E1D443,0x9AA50F6F,0x47E0A5D7,0x25C22CEE,0xF8878656,0xE1873E9C,0x3CC29424,0x5EE01D1D,0x83A5B7A5,
+        0xF90696D8,0x24433C60,0x4661B559,0x9B241FE1,0x8224A72B,0x5F610D93,0x3D4384AA,0xE0062E12,0x0F42F53E,0xD2075F86,0xB025D6BF,0x6D607C07,0x7460C4CD,0xA9256E75,0xCB07E74C,0x16424DF4,
+        0x106227E5,0xCD278D5D,0xAF050464,0x7240AEDC,0x6B401616,0xB605BCAE,0xD4273597,0x09629F2F,0xE6264403,0x3B63EEBB,0x59416782,0x8404CD3A,0x9D0475F0,0x4041DF48,0x22635671,0xFF26FCC9,
+        0x2E238253,0xF36628EB,0x9144A1D2,0x4C010B6A,0x5501B3A0,0x88441918,0xEA669021,0x37233A99,0xD867E1B5,0x05224B0D,0x6700C234,0xBA45688C,0xA345D046,0x7E007AFE,0x1C22F3C7,0xC167597F,
+        0xC747336E,0x1A0299D6,0x782010EF,0xA565BA57,0xBC65029D,0x6120A825,0x0302211C,0xDE478BA4,0x31035088,0xEC46FA30,0x8E647309,0x5321D9B1,0x4A21617B,0x9764CBC3,0xF54642FA,0x2803E842,
+    },
+    {
+        0x00000000,0x38116FAC,0x7022DF58,0x4833B0F4,0xE045BEB0,0xD854D11C,0x906761E8,0xA8760E44,0xC5670B91,0xFD76643D,0xB545D4C9,0x8D54BB65,0x2522B521,0x1D33DA8D,0x55006A79,0x6D1105D5,
+        0x8F2261D3,0xB7330E7F,0xFF00BE8B,0xC711D127,0x6F67DF63,0x5776B0CF,0x1F45003B,0x27546F97,0x4A456A42,0x725405EE,0x3A67B51A,0x0276DAB6,0xAA00D4F2,0x9211BB5E,0xDA220BAA,0xE2336406,
+        0x1BA8B557,0x23B9DAFB,0x6B8A6A0F,0x539B05A3,0xFBED0BE7,0xC3FC644B,0x8BCFD4BF,0xB3DEBB13,0xDECFBEC6,0xE6DED16A,0xAEED619E,0x96FC0E32,0x3E8A0076,0x069B6FDA,0x4EA8DF2E,0x76B9B082,
+        0x948AD484,0xAC9BBB28,0xE4A80BDC,0xDCB96470,0x74CF6A34,0x4CDE0598,0x04EDB56C,0x3CFCDAC0,0x51EDDF15,0x69FCB0B9,0x21CF004D,0x19DE6FE1,0xB1A861A5,0x89B90E09,0xC18ABEFD,0xF99BD151,
+        0x37516AAE,0x0F400502,0x4773B5F6,0x7F62DA5A,0xD714D41E,0xEF05BBB2,0xA7360B46,0x9F2764EA,0xF236613F,0xCA270E93,0x8214BE67,0xBA05D1CB,0x1273DF8F,0x2A62B023,0x625100D7,0x5A406F7B,
+        0xB8730B7D,0x806264D1,0xC851D425,0xF040BB89,0x5836B5CD,0x6027DA61,0x28146A95,0x10050539,0x7D1400EC,0x45056F40,0x0D36DFB4,0x3527B018,0x9D51BE5C,0xA540D1F0,0xED736104,0xD5620EA8,
+        0x2CF9DFF9,0x14E8B055,0x5CDB00A1,0x64CA6F0D,0xCCBC6149,0xF4AD0EE5,0xBC9EBE11,0x848FD1BD,0xE99ED468,0xD18FBBC4,0x99BC0B30,0xA1AD649C,0x09DB6AD8,0x31CA0574,0x79F9B580,0x41E8DA2C,
+        0xA3DBBE2A,0x9BCAD186,0xD3F96172,0xEBE80EDE,0x439E009A,0x7B8F6F36,0x33BCDFC2,0x0BADB06E,0x66BCB5BB,0x5EADDA17,0x169E6AE3,0x2E8F054F,0x86F90B0B,0xBEE864A7,0xF6DBD453,0xCECABBFF,
+        0x6EA2D55C,0x56B3BAF0,0x1E800A04,0x269165A8,0x8EE76BEC,0xB6F60440,0xFEC5B4B4,0xC6D4DB18,0xABC5DECD,0x93D4B161,0xDBE70195,0xE3F66E39,0x4B80607D,0x73910FD1,0x3BA2BF25,0x03B3D089,
+        0xE180B48F,0xD991DB23,0x91A26BD7,0xA9B3047B,0x01C50A3F,0x39D46593,0x71E7D567,0x49F6BACB,0x24E7BF1E,0x1CF6D0B2,0x54C56046,0x6CD40FEA,0xC4A201AE,0xFCB36E02,0xB480DEF6,0x8C91B15A,
+        0x750A600B,0x4D1B0FA7,0x0528BF53,0x3D39D0FF,0x954FDEBB,0xAD5EB117,0xE56D01E3,0xDD7C6E4F,0xB06D6B9A,0x887C0436,0xC04FB4C2,0xF85EDB6E,0x5028D52A,0x6839BA86,0x200A0A72,0x181B65DE,
+        0xFA2801D8,0xC2396E74,0x8A0ADE80,0xB21BB12C,0x1A6DBF68,0x227CD0C4,0x6A4F6030,0x525E0F9C,0x3F4F0A49,0x075E65E5,0x4F6DD511,0x777CBABD,0xDF0AB4F9,0xE71BDB55,0xAF286BA1,0x9739040D,
+        0x59F3BFF2,0x61E2D05E,0x29D160AA,0x11C00F06,0xB9B60142,0x81A76EEE,0xC994DE1A,0xF185B1B6,0x9C94B463,0xA485DBCF,0xECB66B3B,0xD4A70497,0x7CD10AD3,0x44C0657F,0x0CF3D58B,0x34E2BA27,
+        0xD6D1DE21,0xEEC0B18D,0xA6F30179,0x9EE26ED5,0x36946091,0x0E850F3D,0x46B6BFC9,0x7EA7D065,0x13B6D5B0,0x2BA7BA1C,0x63940AE8,0x5B856544,0xF3F36B00,0xCBE204AC,0x83D1B458,0xBBC0DBF4,
+        0x425B0AA5,0x7A4A6509,0x3279D5FD,0x0A68BA51,0xA21EB415,0x9A0FDBB9,0xD23C6B4D,0xEA2D04E1,0x873C0134,0xBF2D6E98,0xF71EDE6C,0xCF0FB1C0,0x6779BF84,0x5F68D028,0x175B60DC,0x2F4A0F70,
+        0xCD796B76,0xF56804DA,0xBD5BB42E,0x854ADB82,0x2D3CD5C6,0x152DBA6A,0x5D1E0A9E,0x650F6532,0x081E60E7,0x300F0F4B,0x783CBFBF,0x402DD013,0xE85BDE57,0xD04AB1FB,0x9879010F,0xA0686EA3,
+    },
+    {
+        0x00000000,0xEF306B19,0xDB8CA0C3,0x34BCCBDA,0xB2F53777,0x5DC55C6E,0x697997B4,0x8649FCAD,0x6006181F,0x8F367306,0xBB8AB8DC,0x54BAD3C5,0xD2F32F68,0x3DC34471,0x097F8FAB,0xE64FE4B2,
+        0xC00C303E,0x2F3C5B27,0x1B8090FD,0xF4B0FBE4,0x72F90749,0x9DC96C50,0xA975A78A,0x4645CC93,0xA00A2821,0x4F3A4338,0x7B8688E2,0x94B6E3FB,0x12FF1F56,0xFDCF744F,0xC973BF95,0x2643D48C,
+        0x85F4168D,0x6AC47D94,0x5E78B64E,0xB148DD57,0x370121FA,0xD8314AE3,0xEC8D8139,0x03BDEA20,0xE5F20E92,0x0AC2658B,0x3E7EAE51,0xD14EC548,0x570739E5,0xB83752FC,0x8C8B9926,0x63BBF23F,
+        0x45F826B3,0xAAC84DAA,0x9E748670,0x7144ED69,0xF70D11C4,0x183D7ADD,0x2C81B107,0xC3B1DA1E,0x25FE3EAC,0xCACE55B5,0xFE729E6F,0x1142F576,0x970B09DB,0x783B62C2,0x4C87A918,0xA3B7C201,
+        0x0E045BEB,0xE13430F2,0xD588FB28,0x3AB89031,0xBCF16C9C,0x53C10785,0x677DCC5F,0x884DA746,0x6E0243F4,0x813228ED,0xB58EE337,0x5ABE882E,0xDCF77483,0x33C71F9A,0x077BD440,0xE84BBF59,
+        0xCE086BD5,0x213800CC,0x1584CB16,0xFAB4A00F,0x7CFD5CA2,0x93CD37BB,0xA771FC61,0x48419778,0xAE0E73CA,0x413E18D3,0x7582D309,0x9AB2B810,0x1CFB44BD,0xF3CB2FA4,0xC777E47E,0x28478F67,
+        0x8BF04D66,0x64C0267F,0x507CEDA5,0xBF4C86BC,0x39057A11,0xD6351108,0xE289DAD2,0x0DB9B1CB,0xEBF65579,0x04C63E60,0x307AF5BA,0xDF4A9EA3,0x5903620E,0xB6330917,0x828FC2CD,0x6DBFA9D4,
+        0x4BFC7D58,0xA4CC1641,0x9070DD9B,0x7F40B682,0xF9094A2F,0x16392136,0x2285EAEC,0xCDB581F5,0x2BFA6547,0xC4CA0E5E,0xF076C584,0x1F46AE9D,0x990F5230,0x763F3929,0x4283F2F3,0xADB399EA,
+        0x1C08B7D6,0xF338DCCF,0xC7841715,0x28B47C0C,0xAEFD80A1,0x41CDEBB8,0x75712062,0x9A414B7B,0x7C0EAFC9,0x933EC4D0,0xA7820F0A,0x48B26413,0xCEFB98BE,0x21CBF3A7,0x1577387D,0xFA475364,
+        0xDC0487E8,0x3334ECF1,0x0788272B,0xE8B84C32,0x6EF1B09F,0x81C1DB86,0xB57D105C,0x5A4D7B45,0xBC029FF7,0x5332F4EE,0x678E3F34,0x88BE542D,0x0EF7A880,0xE1C7C399,0xD57B0843,0x3A4B635A,
+        0x99FCA15B,0x76CCCA42,0x42700198,0xAD406A81,0x2B09962C,0xC439FD35,0xF08536EF,0x1FB55DF6,0xF9FAB944,0x16CAD25D,0x22761987,0xCD46729E,0x4B0F8E33,0xA43FE52A,0x90832EF0,0x7FB345E9,
+        0x59F09165,0xB6C0FA7C,0x827C31A6,0x6D4C5ABF,0xEB05A612,0x0435CD0B,0x308906D1,0xDFB96DC8,0x39F6897A,0xD6C6E263,0xE27A29B9,0x0D4A42A0,0x8B03BE0D,0x6433D514,0x508F1ECE,0xBFBF75D7,
+        0x120CEC3D,0xFD3C8724,0xC9804CFE,0x26B027E7,0xA0F9DB4A,0x4FC9B053,0x7B757B89,0x94451090,0x720AF422,0x9D3A9F3B,0xA98654E1,0x46B63FF8,0xC0FFC355,0x2FCFA84C,0x1B736396,0xF443088F,
+        0xD200DC03,0x3D30B71A,0x098C7CC0,0xE6BC17D9,0x60F5EB74,0x8FC5806D,0xBB794BB7,0x544920AE,0xB206C41C,0x5D36AF05,0x698A64DF,0x86BA0FC6,0x00F3F36B,0xEFC39872,0xDB7F53A8,0x344F38B1,
+        0x97F8FAB0,0x78C891A9,0x4C745A73,0xA344316A,0x250DCDC7,0xCA3DA6DE,0xFE816D04,0x11B1061D,0xF7FEE2AF,0x18CE89B6,0x2C72426C,0xC3422975,0x450BD5D8,0xAA3BBEC1,0x9E87751B,0x71B71E02,
+        0x57F4CA8E,0xB8C4A197,0x8C786A4D,0x63480154,0xE501FDF9,0x0A3196E0,0x3E8D5D3A,0xD1BD3623,0x37F2D291,0xD8C2B988,0xEC7E7252,0x034E194B,0x8507E5E6,0x6A378EFF,0x5E8B4525,0xB1BB2E3C,
+    },
+    {
+        0x00000000,0x68032CC8,0xD0065990,0xB8057558,0xA5E0C5D1,0xCDE3E919,0x75E69C41,0x1DE5B089,0x4E2DFD53,0x262ED19B,0x9E2BA4C3,0xF628880B,0xEBCD3882,0x83CE144A,0x3BCB6112,0x53C84DDA,
+        0x9C5BFAA6,0xF458D66E,0x4C5DA336,0x245E8FFE,0x39BB3F77,0x51B813BF,0xE9BD66E7,0x81BE4A2F,0xD27607F5,0xBA752B3D,0x02705E65,0x6A7372AD,0x7796C224,0x1F95EEEC,0xA7909BB4,0xCF93B77C,
+        0x3D5B83BD,0x5558AF75,0xED5DDA2D,0x855EF6E5,0x98BB466C,0xF0B86AA4,0x48BD1FFC,0x20BE3334,0x73767EEE,0x1B755226,0xA370277E,0xCB730BB6,0xD696BB3F,0xBE9597F7,0x0690E2AF,0x6E93CE67,
+        0xA100791B,0xC90355D3,0x7106208B,0x19050C43,0x04E0BCCA,0x6CE39002,0xD4E6E55A,0xBCE5C992,0xEF2D8448,0x872EA880,0x3F2BDDD8,0x5728F110,0x4ACD4199,0x22CE6D51,0x9ACB1809,0xF2C834C1,
+        0x7AB7077A,0x12B42BB2,0xAAB15EEA,0xC2B27222,0xDF57C2AB,0xB754EE63,0x0F519B3B,0x6752B7F3,0x349AFA29,0x5C99D6E1,0xE49CA3B9,0x8C9F8F71,0x917A3FF8,0xF9791330,0x417C6668,0x297F4AA0,
+        0xE6ECFDDC,0x8EEFD114,0x36EAA44C,0x5EE98884,0x430C380D,0x2B0F14C5,0x930A619D,0xFB094D55,0xA8C1008F,0xC0C22C47,0x78C7591F,0x10C475D7,0x0D21C55E,0x6522E996,0xDD279CCE,0xB524B006,
+        0x47EC84C7,0x2FEFA80F,0x97EADD57,0xFFE9F19F,0xE20C4116,0x8A0F6DDE,0x320A1886,0x5A09344E,0x09C17994,0x61C2555C,0xD9C72004,0xB1C40CCC,0xAC21BC45,0xC422908D,0x7C27E5D5,0x1424C91D,
+        0xDBB77E61,0xB3B452A9,0x0BB127F1,0x63B20B39,0x7E57BBB0,0x16549778,0xAE51E220,0xC652CEE8,0x959A8332,0xFD99AFFA,0x459CDAA2,0x2D9FF66A,0x307A46E3,0x58796A2B,0xE07C1F73,0x887F33BB,
+        0xF56E0EF4,0x9D6D223C,0x25685764,0x4D6B7BAC,0x508ECB25,0x388DE7ED,0x808892B5,0xE88BBE7D,0xBB43F3A7,0xD340DF6F,0x6B45AA37,0x034686FF,0x1EA33676,0x76A01ABE,0xCEA56FE6,0xA6A6432E,
+        0x6935F452,0x0136D89A,0xB933ADC2,0xD130810A,0xCCD53183,0xA4D61D4B,0x1CD36813,0x74D044DB,0x27180901,0x4F1B25C9,0xF71E5091,0x9F1D7C59,0x82F8CCD0,0xEAFBE018,0x52FE9540,0x3AFDB988,
+        0xC8358D49,0xA036A181,0x1833D4D9,0x7030F811,0x6DD54898,0x05D66450,0xBDD31108,0xD5D03DC0,0x8618701A,0xEE1B5CD2,0x561E298A,0x3E1D0542,0x23F8B5CB,0x4BFB9903,0xF3FEEC5B,0x9BFDC093,
+        0x546E77EF,0x3C6D5B27,0x84682E7F,0xEC6B02B7,0xF18EB23E,0x998D9EF6,0x2188EBAE,0x498BC766,0x1A438ABC,0x7240A674,0xCA45D32C,0xA246FFE4,0xBFA34F6D,0xD7A063A5,0x6FA516FD,0x07A63A35,
+        0x8FD9098E,0xE7DA2546,0x5FDF501E,0x37DC7CD6,0x2A39CC5F,0x423AE097,0xFA3F95CF,0x923CB907,0xC1F4F4DD,0xA9F7D815,0x11F2AD4D,0x79F18185,0x6414310C,0x0C171DC4,0xB412689C,0xDC114454,
+        0x1382F328,0x7B81DFE0,0xC384AAB8,0xAB878670,0xB66236F9,0xDE611A31,0x66646F69,0x0E6743A1,0x5DAF0E7B,0x35AC22B3,0x8DA957EB,0xE5AA7B23,0xF84FCBAA,0x904CE762,0x2849923A,0x404ABEF2,
+        0xB2828A33,0xDA81A6FB,0x6284D3A3,0x0A87FF6B,0x17624FE2,0x7F61632A,0xC7641672,0xAF673ABA,0xFCAF7760,0x94AC5BA8,0x2CA92EF0,0x44AA0238,0x594FB2B1,0x314C9E79,0x8949EB21,0xE14AC7E9,
+        0x2ED97095,0x46DA5C5D,0xFEDF2905,0x96DC05CD,0x8B39B544,0xE33A998C,0x5B3FECD4,0x333CC01C,0x60F48DC6,0x08F7A10E,0xB0F2D456,0xD8F1F89E,0xC5144817,0xAD1764DF,0x15121187,0x7D113D4F,
+    },
+    {
+        0x00000000,0x493C7D27,0x9278FA4E,0xDB448769,0x211D826D,0x6821FF4A,0xB3657823,0xFA590504,0x423B04DA,0x0B0779FD,0xD043FE94,0x997F83B3,0x632686B7,0x2A1AFB90,0xF15E7CF9,0xB86201DE,
+        0x847609B4,0xCD4A7493,0x160EF3FA,0x5F328EDD,0xA56B8BD9,0xEC57F6FE,0x37137197,0x7E2F0CB0,0xC64D0D6E,0x8F717049,0x5435F720,0x1D098A07,0xE7508F03,0xAE6CF224,0x7528754D,0x3C14086A,
+        0x0D006599,0x443C18BE,0x9F789FD7,0xD644E2F0,0x2C1DE7F4,0x65219AD3,0xBE651DBA,0xF759609D,0x4F3B6143,0x06071C64,0xDD439B0D,0x947FE62A,0x6E26E32E,0x271A9E09,0xFC5E1960,0xB5626447,
+        0x89766C2D,0xC04A110A,0x1B0E9663,0x5232EB44,0xA86BEE40,0xE1579367,0x3A13140E,0x732F6929,0xCB4D68F7,0x827115D0,0x593592B9,0x1009EF9E,0xEA50EA9A,0xA36C97BD,0x782810D4,0x31146DF3,
+        0x1A00CB32,0x533CB615,0x8878317C,0xC1444C5B,0x3B1D495F,0x72213478,0xA965B311,0xE059CE36,0x583BCFE8,0x1107B2CF,0xCA4335A6,0x837F4881,0x79264D85,0x301A30A2,0xEB5EB7CB,0xA262CAEC,
+        0x9E76C286,0xD74ABFA1,0x0C0E38C8,0x453245EF,0xBF6B40EB,0xF6573DCC,0x2D13BAA5,0x642FC782,0xDC4DC65C,0x9571BB7B,0x4E353C12,0x07094135,0xFD504431,0xB46C3916,0x6F28BE7F,0x2614C358,
+        0x1700AEAB,0x5E3CD38C,0x857854E5,0xCC4429C2,0x361D2CC6,0x7F2151E1,0xA465D688,0xED59ABAF,0x553BAA71,0x1C07D756,0xC743503F,0x8E7F2D18,0x7426281C,0x3D1A553B,0xE65ED252,0xAF62AF75,
+        0x9376A71F,0xDA4ADA38,0x010E5D51,0x48322076,0xB26B2572,0xFB575855,0x2013DF3C,0x692FA21B,0xD14DA3C5,0x9871DEE2,0x4335598B,0x0A0924AC,0xF05021A8,0xB96C5C8F,0x6228DBE6,0x2B14A6C1,
+        0x34019664,0x7D3DEB43,0xA6796C2A,0xEF45110D,0x151C1409,0x5C20692E,0x8764EE47,0xCE589360,0x763A92BE,0x3F06EF99,0xE44268F0,0xAD7E15D7,0x572710D3,0x1E1B6DF4,0xC55FEA9D,0x8C6397BA,
+        0xB0779FD0,0xF94BE2F7,0x220F659E,0x6B3318B9,0x916A1DBD,0xD856609A,0x0312E7F3,0x4A2E9AD4,0xF24C9B0A,0xBB70E62D,0x60346144,0x29081C63,0xD3511967,0x9A6D6440,0x4129E329,0x08159E0E,
+        0x3901F3FD,0x703D8EDA,0xAB7909B3,0xE2457494,0x181C7190,0x51200CB7,0x8A648BDE,0xC358F6F9,0x7B3AF727,0x32068A00,0xE9420D69,0xA07E704E,0x5A27754A,0x131B086D,0xC85F8F04,0x8163F223,
+        0xBD77FA49,0xF44B876E,0x2F0F0007,0x66337D20,0x9C6A7824,0xD5560503,0x0E12826A,0x472EFF4D,0xFF4CFE93,0xB67083B4,0x6D3404DD,0x240879FA,0xDE517CFE,0x976D01D9,0x4C2986B0,0x0515FB97,
+        0x2E015D56,0x673D2071,0xBC79A718,0xF545DA3F,0x0F1CDF3B,0x4620A21C,0x9D642575,0xD4585852,0x6C3A598C,0x250624AB,0xFE42A3C2,0xB77EDEE5,0x4D27DBE1,0x041BA6C6,0xDF5F21AF,0x96635C88,
+        0xAA7754E2,0xE34B29C5,0x380FAEAC,0x7133D38B,0x8B6AD68F,0xC256ABA8,0x19122CC1,0x502E51E6,0xE84C5038,0xA1702D1F,0x7A34AA76,0x3308D751,0xC951D255,0x806DAF72,0x5B29281B,0x1215553C,
+        0x230138CF,0x6A3D45E8,0xB179C281,0xF845BFA6,0x021CBAA2,0x4B20C785,0x906440EC,0xD9583DCB,0x613A3C15,0x28064132,0xF342C65B,0xBA7EBB7C,0x4027BE78,0x091BC35F,0xD25F4436,0x9B633911,
+        0xA777317B,0xEE4B4C5C,0x350FCB35,0x7C33B612,0x866AB316,0xCF56CE31,0x14124958,0x5D2E347F,0xE54C35A1,0xAC704886,0x7734CFEF,0x3E08B2C8,0xC451B7CC,0x8D6DCAEB,0x56294D82,0x1F1530A5,
+    },
+};
+
+static inline ImU32 ImCrc32cRead32(const unsigned char* p) { return (ImU32)p[0] | ((ImU32)p[1] << 8) | ((ImU32)p[2] << 16) | ((ImU32)p[3] << 24); }
+
+static ImU32 ImCrc32cUpdateSoftware(ImU32 crc, const unsigned char* data, size_t data_size)
+{
+    const ImU32 (*lut)[256] = GCrc32cLookupTable;
+    for (; data_size >= 8; data_size -= 8, data += 8)
+    {
+        ImU32 lo = ImCrc32cRead32(data) ^ crc;
+        ImU32 hi = ImCrc32cRead32(data + 4);
+        crc = lut[7][lo & 0xFF] ^ lut[6][(lo >> 8) & 0xFF] ^ lut[5][(lo >> 16) & 0xFF] ^ lut[4][lo >> 24] ^
+              lut[3][hi & 0xFF] ^ lut[2][(hi >> 8) & 0xFF] ^ lut[1][(hi >> 16) & 0xFF] ^ lut[0][hi >> 24];
+    }
+    while (data_size-- != 0)
+        crc = (crc >> 8) ^ lut[0][(crc ^ *data++) & 0xFF];
+    return crc;
+}
+
+#if defined(IMGUI_CRC32C_SSE42)
+#if defined(IMGUI_CRC32C_SSE42_RUNTIME_CHECK) && (defined(__GNUC__) || defined(__clang__))
+__attribute__((target("sse4.2")))
+#endif
+static ImU32 ImCrc32cUpdateHardware(ImU32 crc, const unsigned char* data, size_t data_size)
+{
+    ImU64 crc64 = crc;
+    for (; data_size >= 8; data_size -= 8, data += 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        crc64 = _mm_crc32_u64(crc64, v);
+    }
+    crc = (ImU32)crc64;
+    while (data_size-- != 0)
+        crc = _mm_crc32_u8(crc, *data++);
+    return crc;
+}
+#elif defined(IMGUI_CRC32C_ARM)
+static ImU32 ImCrc32cUpdateHardware(ImU32 crc, const unsigned char* data, size_t data_size)
+{
+    for (; data_size >= 8; data_size -= 8, data += 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        crc = __crc32cd(crc, v);
+    }
+    while (data_size-- != 0)
+        crc = __crc32cb(crc, *data++);
+    return crc;
+}
+#endif
+
+#ifdef IMGUI_CRC32C_SSE42_RUNTIME_CHECK
+static bool ImCrc32cCheckHardwareSupport()
+{
+#if defined(_MSC_VER)
+    int cpu_info[4];
+    __cpuid(cpu_info, 1);
+    return (cpu_info[2] & (1 << 20)) != 0; // ECX bit 20: SSE 4.2
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse4.2") != 0;
+#endif
+}
+// Checked once by a static initializer, before any thread can be started: afterward it is only ever read.
+// Hashes computed by static initializers of other translation units running earlier see 'false' and use the portable
+// version, which returns the same values.
+static bool GCrc32cHardwareSupport = ImCrc32cCheckHardwareSupport();
+#endif
+
+static inline ImU32 ImCrc32cUpdate(ImU32 crc, const unsigned char* data, size_t data_size)
+{
+#if defined(IMGUI_CRC32C_SSE42_RUNTIME_CHECK)
+    if (GCrc32cHardwareSupport)
+        return ImCrc32cUpdateHardware(crc, data, data_size);
+    return ImCrc32cUpdateSoftware(crc, data, data_size);
+#elif defined(IMGUI_CRC32C_SSE42) || defined(IMGUI_CRC32C_ARM)
+    return ImCrc32cUpdateHardware(crc, data, data_size);
+#else
+    return ImCrc32cUpdateSoftware(crc, data, data_size);
+#endif
+}
+
+// Known size hash
+// It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
+ImU32 ImHashData(const void* data_p, size_t data_size, ImU32 seed)
+{
+    return ~ImCrc32cUpdate(~seed, (const unsigned char*)data_p, data_size);
+}
+
+// Zero-terminated string hash, with support for ### to reset back to seed value
+// We support a syntax of "label###id" where only "###id" is included in the hash, and only "label" gets displayed.
+// Because this syntax is rarely used we are optimizing for the common case.
+// - If we reach ### in the string we discard the hash so far and reset to the seed: this is the same as hashing from the last ### onward.
+// - We locate it with memchr() which is vectorized by most C libraries, then hash the remaining bytes in bulk.
+ImU32 ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
+{
+    if (data_size == 0)
+        data_size = strlen(data_p);
+    const char* data_end = data_p + data_size;
+    const char* hash_begin = data_p;
+    for (const char* p = data_p; (p = (const char*)memchr(p, '#', (size_t)(data_end - p))) != NULL; p++)
+        if (data_end - p >= 3 && p[1] == '#' && p[2] == '#')
+            hash_begin = p;
+    return ~ImCrc32cUpdate(~seed, (const unsigned char*)hash_begin, (size_t)(data_end - hash_begin));
+}
+
+#else // #ifndef IMGUI_USE_LEGACY_CRC32_HASH
+
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
@@ -1544,6 +2060,8 @@ ImU32 ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
     return ~crc;
 }
 
+#endif // #ifndef IMGUI_USE_LEGACY_CRC32_HASH
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
 //-----------------------------------------------------------------------------
@@ -1558,11 +2076,18 @@ ImFileHandle ImFileOpen(const char* filename, const char* mode)
     // Previously we used ImTextCountCharsFromUtf8/ImTextStrFromUtf8 here but we now need to support ImWchar16 and ImWchar32!
     const int filename_wsize = ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, NULL, 0);
     const int mode_wsize = ::MultiByteToWideChar(CP_UTF8, 0, mode, -1, NULL, 0);
-    ImVector<ImWchar> buf;
-    buf.resize(filename_wsize + mode_wsize);
-    ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, (wchar_t*)&buf[0], filename_wsize);
-    ::MultiByteToWideChar(CP_UTF8, 0, mode, -1, (wchar_t*)&buf[filename_wsize], mode_wsize);
-    return ::_wfopen((const wchar_t*)&buf[0], (const wchar_t*)&buf[filename_wsize]);
+    // Convert on the stack for common path lengths: this doesn't allocate, so it can be called from the .ini settings writer thread.
+    wchar_t local_buf[512];
+    ImVector<wchar_t> buf;
+    wchar_t* wbuf = local_buf;
+    if (filename_wsize + mode_wsize > IM_ARRAYSIZE(local_buf))
+    {
+        buf.resize(filename_wsize + mode_wsize);
+        wbuf = buf.Data;
+    }
+    ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, wbuf, filename_wsize);
+    ::MultiByteToWideChar(CP_UTF8, 0, mode, -1, wbuf + filename_wsize, mode_wsize);
+    return ::_wfopen(wbuf, wbuf + filename_wsize);
 #else
     return fopen(filename, mode);
 #endif
@@ -1690,8 +2215,11 @@ int ImTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const cha
     ImWchar* buf_end = buf + buf_size;
     while (buf_out < buf_end-1 && (!in_text_end || in_text < in_text_end) && *in_text)
     {
-        unsigned int c;
-        in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
+        unsigned int c = (unsigned char)*in_text;
+        if (c < 0x80)
+            in_text++;
+        else
+            in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
         if (c == 0)
             break;
         *buf_out++ = (ImWchar)c;
@@ -1911,6 +2439,105 @@ static ImGuiStorage::ImGuiStoragePair* LowerBound(ImVector<ImGuiStorage::ImGuiSt
     return first;
 }
 
+// Robin Hood hashing over HashIndex[]: slots are kept ordered by distance to their home slot, which bounds probe lengths
+// and lets a failed query stop as soon as it meets a slot closer to its home than we are to ours.
+// Keys are generally already hashed (ImGuiID), but we still scramble them because we only use the lower bits.
+static inline int StorageHashSlot(ImGuiID key, int mask)
+{
+    ImU32 h = key * 0x9E3779B1u;
+    return (int)((h ^ (h >> 15)) & (ImU32)mask);
+}
+
+static int StorageHashIndexFind(const ImVector<ImGuiStorage::ImGuiStorageSlot>& hash_index, ImGuiID key)
+{
+    const int mask = hash_index.Size - 1;
+    for (int pos = StorageHashSlot(key, mask), dist = 0; ; pos = (pos + 1) & mask, dist++)
+    {
+        const ImGuiStorage::ImGuiStorageSlot& slot = hash_index.Data[pos];
+        if (slot.index < 0 || ((pos - StorageHashSlot(slot.key, mask)) & mask) < dist)
+            return -1;
+        if (slot.key == key)
+            return slot.index;
+    }
+}
+
+static void StorageHashIndexInsert(ImVector<ImGuiStorage::ImGuiStorageSlot>& hash_index, ImGuiID key, int index)
+{
+    const int mask = hash_index.Size - 1;
+    ImGuiStorage::ImGuiStorageSlot ins = { key, index };
+    for (int pos = StorageHashSlot(key, mask), dist = 0; ; pos = (pos + 1) & mask, dist++)
+    {
+        ImGuiStorage::ImGuiStorageSlot& slot = hash_index.Data[pos];
+        if (slot.index < 0)
+        {
+            slot = ins;
+            return;
+        }
+        const int slot_dist = (pos - StorageHashSlot(slot.key, mask)) & mask;
+        if (slot_dist < dist)
+        {
+            ImSwap(slot, ins);
+            dist = slot_dist;
+        }
+    }
+}
+
+// Rebuild HashIndex[] from Data[], sized for 'count' pairs with a maximum load factor of 3/4.
+static void StorageBuildHashIndex(ImGuiStorage* storage, int count)
+{
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Storage);
+    int capacity = 16;
+    while (capacity * 3 < count * 4)
+        capacity *= 2;
+    storage->HashIndex.resize(capacity);
+    for (int n = 0; n < capacity; n++)
+        storage->HashIndex.Data[n].index = -1;
+    for (int n = 0; n < storage->Data.Size; n++)
+        StorageHashIndexInsert(storage->HashIndex, storage->Data.Data[n].key, n);
+}
+
+static ImGuiStorage::ImGuiStoragePair* StorageFind(const ImGuiStorage* storage, ImGuiID key)
+{
+    ImVector<ImGuiStorage::ImGuiStoragePair>& data = const_cast<ImVector<ImGuiStorage::ImGuiStoragePair>&>(storage->Data);
+    if (storage->HashIndex.Size > 0)
+    {
+        int index = StorageHashIndexFind(storage->HashIndex, key);
+        return (index >= 0) ? &data.Data[index] : NULL;
+    }
+    ImGuiStorage::ImGuiStoragePair* it = LowerBound(data, key);
+    return (it == data.end() || it->key != key) ? NULL : it;
+}
+
+// Find pair, insert 'new_pair' if missing.
+static ImGuiStorage::ImGuiStoragePair* StorageFindOrInsert(ImGuiStorage* storage, const ImGuiStorage::ImGuiStoragePair& new_pair)
+{
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Storage);
+    ImVector<ImGuiStorage::ImGuiStoragePair>& data = storage->Data;
+    if (storage->HashIndex.Size > 0)
+    {
+        int index = StorageHashIndexFind(storage->HashIndex, new_pair.key);
+        if (index >= 0)
+            return &data.Data[index];
+        data.push_back(new_pair);
+        if (data.Size * 4 > storage->HashIndex.Size * 3)
+            StorageBuildHashIndex(storage, data.Size * 2);
+        else
+            StorageHashIndexInsert(storage->HashIndex, new_pair.key, data.Size - 1);
+        return &data.back();
+    }
+    ImGuiStorage::ImGuiStoragePair* it = LowerBound(data, new_pair.key);
+    if (it == data.end() || it->key != new_pair.key)
+        it = data.insert(it, new_pair);
+    return it;
+}
+
+void ImGuiStorage::Clear()
+{
+    Data.clear();
+    if (HashIndex.Size > 0)
+        StorageBuildHashIndex(this, 0);
+}
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
@@ -1926,14 +2553,27 @@ void ImGuiStorage::BuildSortByKey()
     };
     if (Data.Size > 1)
         ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), StaticFunc::PairCompareByID);
+    if (HashIndex.Size > 0)
+        StorageBuildHashIndex(this, Data.Size);
+}
+
+void ImGuiStorage::SetHashIndex(bool enable)
+{
+    if (enable && HashIndex.Size == 0)
+    {
+        StorageBuildHashIndex(this, Data.Size);
+    }
+    else if (!enable && HashIndex.Size > 0)
+    {
+        HashIndex.clear();
+        BuildSortByKey();
+    }
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_i;
+    ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_i : default_val;
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -1943,27 +2583,20 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_f;
+    ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_f : default_val;
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return NULL;
-    return it->val_p;
+    ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_p : NULL;
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_i;
+    return &StorageFindOrInsert(this, ImGuiStoragePair(key, default_val))->val_i;
 }
 
 bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
@@ -1973,30 +2606,17 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_f;
+    return &StorageFindOrInsert(this, ImGuiStoragePair(key, default_val))->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_p;
+    return &StorageFindOrInsert(this, ImGuiStoragePair(key, default_val))->val_p;
 }
 
-// FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_i = val;
+    StorageFindOrInsert(this, ImGuiStoragePair(key, val))->val_i = val;
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -2006,24 +2626,12 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_f = val;
+    StorageFindOrInsert(this, ImGuiStoragePair(key, val))->val_f = val;
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_p = val;
+    StorageFindOrInsert(this, ImGuiStoragePair(key, val))->val_p = val;
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -2179,18 +2787,36 @@ void ImGuiTextBuffer::appendf(const char* fmt, ...)
 // Helper: Text buffer for logging/accumulating text
 void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
 {
-    va_list args_copy;
+    va_list args_copy, args_copy2;
     va_copy(args_copy, args);
+    va_copy(args_copy2, args);
+
+    // Add zero-terminator the first time
+    const int write_off = (Buf.Size != 0) ? Buf.Size : 1;
+
+    // Attempt to write in the remaining capacity first, which usually succeeds (e.g. when saving .ini settings) and saves a formatting pass.
+    // A result filling the whole capacity may have been truncated, so we only accept results which are strictly smaller.
+    if (Buf.Capacity > write_off)
+    {
+        const int avail_sz = Buf.Capacity - write_off + 1;
+        const int len = ImFormatStringV(&Buf.Data[write_off - 1], (size_t)avail_sz, fmt, args);
+        if (len < avail_sz - 1)
+        {
+            Buf.Size = write_off + len;
+            va_end(args_copy);
+            va_end(args_copy2);
+            return;
+        }
+    }
 
-    int len = ImFormatStringV(NULL, 0, fmt, args);         // FIXME-OPT: could do a first pass write attempt, likely successful on first pass.
+    int len = ImFormatStringV(NULL, 0, fmt, args_copy);
+    va_end(args_copy);
     if (len <= 0)
     {
-        va_end(args_copy);
+        va_end(args_copy2);
         return;
     }
 
-    // Add zero-terminator the first time
-    const int write_off = (Buf.Size != 0) ? Buf.Size : 1;
     const int needed_sz = write_off + len;
     if (write_off + len >= Buf.Capacity)
     {
@@ -2199,8 +2825,8 @@ void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
     }
 
     Buf.resize(needed_sz);
-    ImFormatStringV(&Buf[write_off - 1], (size_t)len + 1, fmt, args_copy);
-    va_end(args_copy);
+    ImFormatStringV(&Buf[write_off - 1], (size_t)len + 1, fmt, args_copy2);
+    va_end(args_copy2);
 }
 
 //-----------------------------------------------------------------------------
@@ -2209,6 +2835,18 @@ void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
 // the API mid-way through development and support two ways to using the clipper, needs some rework (see TODO)
 //-----------------------------------------------------------------------------
 
+// We create the union of the ClipRect and the NavScoringRect which at worst should be 1 page away from ClipRect
+static ImRect GetListClippingRect(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImRect unclipped_rect = window->ClipRect;
+    if (g.NavMoveRequest)
+        unclipped_rect.Add(g.NavScoringRect);
+    if (g.NavJustMovedToId && window->NavLastIds[0] == g.NavJustMovedToId)
+        unclipped_rect.Add(ImRect(window->Pos + window->NavRectRel[0].Min, window->Pos + window->NavRectRel[0].Max));
+    return unclipped_rect;
+}
+
 // Helper to calculate coarse clipping of large list of evenly sized items.
 // NB: Prefer using the ImGuiListClipper higher-level helper if you can! Read comments and instructions there on how those use this sort of pattern.
 // NB: 'items_count' is only used to clamp the result, if you don't know your count you can use INT_MAX
@@ -2229,13 +2867,7 @@ void ImGui::CalcListClipping(int items_count, float items_height, int* out_items
         return;
     }
 
-    // We create the union of the ClipRect and the NavScoringRect which at worst should be 1 page away from ClipRect
-    ImRect unclipped_rect = window->ClipRect;
-    if (g.NavMoveRequest)
-        unclipped_rect.Add(g.NavScoringRect);
-    if (g.NavJustMovedToId && window->NavLastIds[0] == g.NavJustMovedToId)
-        unclipped_rect.Add(ImRect(window->Pos + window->NavRectRel[0].Min, window->Pos + window->NavRectRel[0].Max));
-
+    const ImRect unclipped_rect = GetListClippingRect(window);
     const ImVec2 pos = window->DC.CursorPos;
     int start = (int)((unclipped_rect.Min.y - pos.y) / items_height);
     int end = (int)((unclipped_rect.Max.y - pos.y) / items_height);
@@ -2267,35 +2899,69 @@ static void SetCursorPosYAndSetupDummyPrevLine(float pos_y, float line_height)
         columns->LineMinY = window->DC.CursorPos.y;                         // Setting this so that cell Y position are set properly
 }
 
+// Number of rows of the grid mode. Without grid mode (1 item per row) this is 'items_count', including the -1 and INT_MAX special values.
+static int GetListClipperRowsCount(int items_count, int items_per_row)
+{
+    if (items_per_row == 1 || items_count < 0 || items_count == INT_MAX)
+        return items_count;
+    return (int)(((ImS64)items_count + items_per_row - 1) / items_per_row);
+}
+
 // Use case A: Begin() called from constructor with items_height<0, then called again from Sync() in StepNo 1
 // Use case B: Begin() called from constructor with items_height>0
 // FIXME-LEGACY: Ideally we should remove the Begin/End functions but they are part of the legacy API we still support. This is why some of the code in Step() calling Begin() and reassign some fields, spaghetti style.
 void ImGuiListClipper::Begin(int count, float items_height)
 {
+    BeginGrid(count, 1, items_height);
+}
+
+// Same as Begin() with 'items_per_row' items on each row: the clipping is calculated on rows, then converted to item indices.
+void ImGuiListClipper::BeginGrid(int count, int items_per_row, float rows_height)
+{
+    IM_ASSERT(items_per_row >= 1);
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = g.CurrentWindow;
 
     StartPosY = window->DC.CursorPos.y;
-    ItemsHeight = items_height;
+    ItemsHeight = rows_height;
     ItemsCount = count;
+    ItemsPerRow = items_per_row;
+    ItemsHeights = NULL;
+    ItemPosY = ClipMaxY = 0.0f;
     StepNo = 0;
     DisplayEnd = DisplayStart = -1;
     if (ItemsHeight > 0.0f)
     {
-        ImGui::CalcListClipping(ItemsCount, ItemsHeight, &DisplayStart, &DisplayEnd); // calculate how many to clip/display
+        ImGui::CalcListClipping(GetListClipperRowsCount(ItemsCount, ItemsPerRow), ItemsHeight, &DisplayStart, &DisplayEnd); // calculate how many to clip/display
         if (DisplayStart > 0)
             SetCursorPosYAndSetupDummyPrevLine(StartPosY + DisplayStart * ItemsHeight, ItemsHeight); // advance cursor
+        if (ItemsPerRow > 1)
+        {
+            DisplayStart = (int)ImMin((ImS64)DisplayStart * ItemsPerRow, (ImS64)ItemsCount);
+            DisplayEnd = (int)ImMin((ImS64)DisplayEnd * ItemsPerRow, (ImS64)ItemsCount);
+        }
         StepNo = 2;
     }
 }
 
+// Heights are measured by Step(), see ImGuiListClipperHeights.
+void ImGuiListClipper::BeginVariable(int count, ImGuiListClipperHeights* heights)
+{
+    IM_ASSERT(heights != NULL && count >= 0 && count < INT_MAX);
+    Begin(count, -1.0f);
+    ItemsHeights = heights;
+    heights->Resize(count);
+}
+
 void ImGuiListClipper::End()
 {
     if (ItemsCount < 0)
         return;
     // In theory here we should assert that ImGui::GetCursorPosY() == StartPosY + DisplayEnd * ItemsHeight, but it feels saner to just seek at the end and not assert/crash the user.
-    if (ItemsCount < INT_MAX)
-        SetCursorPosYAndSetupDummyPrevLine(StartPosY + ItemsCount * ItemsHeight, ItemsHeight); // advance cursor
+    if (ItemsHeights != NULL)
+        SetCursorPosYAndSetupDummyPrevLine(StartPosY + (float)ItemsHeights->TotalHeight, ItemsCount > 0 ? ItemsHeights->Heights[ItemsCount - 1] : 0.0f); // advance cursor
+    else if (ItemsCount < INT_MAX)
+        SetCursorPosYAndSetupDummyPrevLine(StartPosY + GetListClipperRowsCount(ItemsCount, ItemsPerRow) * ItemsHeight, ItemsHeight); // advance cursor
     ItemsCount = -1;
     StepNo = 3;
 }
@@ -2310,22 +2976,67 @@ bool ImGuiListClipper::Step()
         ItemsCount = -1;
         return false;
     }
+    if (ItemsHeights != NULL) // Variable height mode: display visible items one at a time and measure each of them.
+    {
+        ImGuiListClipperHeights* heights = ItemsHeights;
+        if (StepNo == 0) // Position the cursor before the first visible item, according to the heights measured so far.
+        {
+            int start = 0;
+            ClipMaxY = FLT_MAX;
+            if (!g.LogEnabled) // If logging is active, do not perform any clipping
+            {
+                const ImRect unclipped_rect = GetListClippingRect(window);
+                start = heights->FindItem(unclipped_rect.Min.y - StartPosY);
+                if (g.NavMoveRequest && g.NavMoveClipDir == ImGuiDir_Up)
+                    start = ImMax(start - 1, 0);
+                ClipMaxY = unclipped_rect.Max.y;
+            }
+            if (start > 0)
+                SetCursorPosYAndSetupDummyPrevLine(StartPosY + (float)heights->GetOffset(start), heights->Heights[start - 1]);
+            ItemPosY = window->DC.CursorPos.y;
+            DisplayStart = start;
+            DisplayEnd = start + 1;
+            StepNo = 1;
+            return true;
+        }
+
+        // Store the height of the item we just submitted, then continue until an item starts below the visible area.
+        // When performing a navigation request, display one extra item in the direction we are moving to (StepNo 2).
+        const float item_height = window->DC.CursorPos.y - ItemPosY;
+        if (item_height != heights->Heights[DisplayStart])
+            heights->SetHeight(DisplayStart, item_height);
+        if (DisplayEnd < ItemsCount && window->DC.CursorPos.y >= ClipMaxY)
+        {
+            if (StepNo == 1 && g.NavMoveRequest && g.NavMoveClipDir == ImGuiDir_Down)
+                StepNo = 2;
+            else
+                DisplayEnd = ItemsCount;
+        }
+        if (DisplayEnd >= ItemsCount)
+        {
+            End();
+            return false;
+        }
+        ItemPosY = window->DC.CursorPos.y;
+        DisplayStart = DisplayEnd++;
+        return true;
+    }
     if (StepNo == 0) // Step 0: the clipper let you process the first element, regardless of it being visible or not, so we can measure the element height.
     {
         DisplayStart = 0;
-        DisplayEnd = 1;
+        DisplayEnd = ImMin(ItemsPerRow, ItemsCount);
         StartPosY = window->DC.CursorPos.y;
         StepNo = 1;
         return true;
     }
     if (StepNo == 1) // Step 1: the clipper infer height from first element, calculate the actual range of elements to display, and position the cursor before the first element.
     {
-        if (ItemsCount == 1) { ItemsCount = -1; return false; }
+        if (ItemsCount <= ItemsPerRow) { ItemsCount = -1; return false; }
         float items_height = window->DC.CursorPos.y - StartPosY;
         IM_ASSERT(items_height > 0.0f);   // If this triggers, it means Item 0 hasn't moved the cursor vertically
-        Begin(ItemsCount - 1, items_height);
-        DisplayStart++;
-        DisplayEnd++;
+        BeginGrid(ItemsCount - ItemsPerRow, ItemsPerRow, items_height);
+        DisplayStart += ItemsPerRow;
+        DisplayEnd += ItemsPerRow;
         StepNo = 3;
         return true;
     }
@@ -2340,6 +3051,87 @@ bool ImGuiListClipper::Step()
     return false;
 }
 
+void ImGuiListClipperHeights::Clear()
+{
+    Heights.clear();
+    Tree.clear();
+    TotalHeight = 0.0;
+}
+
+void ImGuiListClipperHeights::Resize(int items_count)
+{
+    IM_ASSERT(items_count >= 0);
+    if (items_count < Heights.Size)
+    {
+        // Rebuild the tree in O(N): each node adds itself to its parent
+        Heights.resize(items_count);
+        Tree.resize(items_count + 1);
+        TotalHeight = 0.0;
+        for (int node = 1; node <= items_count; node++)
+            Tree[node] = Heights[node - 1];
+        for (int node = 1; node <= items_count; node++)
+        {
+            const int parent = node + (node & -node);
+            if (parent <= items_count)
+                Tree[parent] += Tree[node];
+            TotalHeight += Heights[node - 1];
+        }
+        return;
+    }
+
+    // Append new items: the node of a new item covers items (node - lowbit(node), node], i.e. the new item plus nodes which are already built
+    const float default_height = (DefaultHeight > 0.0f) ? DefaultHeight : ImGui::GetTextLineHeightWithSpacing();
+    if (Tree.Size == 0)
+        Tree.push_back(0.0);
+    for (int node = Heights.Size + 1; node <= items_count; node++)
+    {
+        double sum = default_height;
+        for (int child = node - 1, child_end = node - (node & -node); child > child_end; child -= child & -child)
+            sum += Tree[child];
+        Heights.push_back(default_height);
+        Tree.push_back(sum);
+        TotalHeight += default_height;
+    }
+}
+
+void ImGuiListClipperHeights::SetHeight(int item_n, float height)
+{
+    IM_ASSERT(item_n >= 0 && item_n < Heights.Size);
+    const double delta = (double)height - (double)Heights[item_n];
+    Heights[item_n] = height;
+    TotalHeight += delta;
+    for (int node = item_n + 1; node < Tree.Size; node += node & -node)
+        Tree[node] += delta;
+}
+
+double ImGuiListClipperHeights::GetOffset(int item_n) const
+{
+    IM_ASSERT(item_n >= 0 && item_n <= Heights.Size);
+    double offset = 0.0;
+    for (int node = item_n; node > 0; node -= node & -node)
+        offset += Tree[node];
+    return offset;
+}
+
+int ImGuiListClipperHeights::FindItem(double offset) const
+{
+    // Descend the tree, skipping every node which ends before 'offset'
+    const int count = Heights.Size;
+    if (count == 0 || offset <= 0.0)
+        return 0;
+    int step = 1;
+    while (step <= count / 2)
+        step <<= 1;
+    int item_n = 0;
+    for (; step > 0; step >>= 1)
+        if (item_n + step <= count && Tree[item_n + step] <= offset)
+        {
+            item_n += step;
+            offset -= Tree[item_n];
+        }
+    return ImMin(item_n, count - 1);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] STYLING
 //-----------------------------------------------------------------------------
@@ -2581,6 +3373,7 @@ const char* ImGui::FindRenderedTextEnd(const char* text, const char* text_end)
 // RenderText***() functions calls ImDrawList::AddText() calls ImBitmapFont::RenderText()
 void ImGui::RenderText(ImVec2 pos, const char* text, const char* text_end, bool hide_text_after_hash)
 {
+    IMGUI_PROFILER_ZONE("RenderText");
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = g.CurrentWindow;
 
@@ -3219,7 +4012,23 @@ void* ImGui::MemAlloc(size_t size)
 {
     if (ImGuiContext* ctx = GImGui)
         ctx->IO.MetricsActiveAllocations++;
+#ifdef IMGUI_ENABLE_MEMORY_ACCOUNTING
+    char* ptr = (char*)GImAllocatorAllocFunc(size + IM_MEMALLOC_HEADER_SIZE, GImAllocatorUserData);
+    if (ptr == NULL)
+        return NULL;
+    ImGuiMemAllocHeader* header = (ImGuiMemAllocHeader*)(void*)ptr;
+    header->Size = size;
+    header->Tag = GImMemTag;
+    if (ImGuiContext* ctx = GImGui)
+        ctx->MemTagAllocCount[GImMemTag]++;
+    ImGuiMemTagStats& stats = GImMemTagStats[GImMemTag];
+    MemTagStatsAdd(&stats.AllocCount, 1);
+    MemTagStatsAdd(&stats.ActiveAllocCount, 1);
+    MemTagStatsMax(&stats.ActiveBytesMax, MemTagStatsAdd(&stats.ActiveBytes, size));
+    return ptr + IM_MEMALLOC_HEADER_SIZE;
+#else
     return GImAllocatorAllocFunc(size, GImAllocatorUserData);
+#endif
 }
 
 // IM_FREE() == ImGui::MemFree()
@@ -3228,16 +4037,141 @@ void ImGui::MemFree(void* ptr)
     if (ptr)
         if (ImGuiContext* ctx = GImGui)
             ctx->IO.MetricsActiveAllocations--;
+#ifdef IMGUI_ENABLE_MEMORY_ACCOUNTING
+    if (ptr)
+    {
+        ptr = (char*)ptr - IM_MEMALLOC_HEADER_SIZE;
+        const ImGuiMemAllocHeader* header = (const ImGuiMemAllocHeader*)ptr;
+        ImGuiMemTagStats& stats = GImMemTagStats[header->Tag];
+        MemTagStatsAdd(&stats.ActiveAllocCount, -1);
+        MemTagStatsAdd(&stats.ActiveBytes, (size_t)0 - header->Size);
+    }
+#endif
     return GImAllocatorFreeFunc(ptr, GImAllocatorUserData);
 }
 
-const char* ImGui::GetClipboardText()
+// IM_ALLOC_FRAME() == ImGui::MemAllocFrame(size, __FILE__, __LINE__)
+void* ImGui::MemAllocFrame(size_t size, const char* file, int line)
 {
-    ImGuiContext& g = *GImGui;
-    return g.IO.GetClipboardTextFn ? g.IO.GetClipboardTextFn(g.IO.ClipboardUserData) : "";
+    IM_ASSERT(GImGui != NULL && "No current context. Did you call ImGui::CreateContext() and ImGui::SetCurrentContext() ?");
+    return GImGui->FrameArena.Alloc(size, file, line);
 }
 
-void ImGui::SetClipboardText(const char* text)
+#define IM_FRAME_ARENA_MIN_BLOCK_SIZE   (16 * 1024)
+
+void* ImGuiFrameArena::Alloc(size_t size, const char* file, int line)
+{
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FrameArena);
+    size = (size + 15) & ~(size_t)15;
+    while (CurrentBlock < Blocks.Size && CurrentOffset + size > Blocks[CurrentBlock].Size)
+    {
+        CurrentBlock++;
+        CurrentOffset = 0;
+    }
+    if (CurrentBlock == Blocks.Size)
+    {
+        ImGuiFrameArenaBlock block;
+        block.Size = ImMax(ImMax(size, (size_t)IM_FRAME_ARENA_MIN_BLOCK_SIZE), Blocks.Size > 0 ? Blocks.back().Size * 2 : 0);
+        block.Data = (char*)IM_ALLOC(block.Size);
+        Blocks.push_back(block);
+    }
+    char* ptr = Blocks[CurrentBlock].Data + CurrentOffset;
+    CurrentOffset += size;
+    UsedBytes += size;
+
+    // Call-site statistics
+    ImGuiFrameArenaCallsite* callsite = NULL;
+    for (int n = 0; n < Callsites.Size && callsite == NULL; n++)
+        if (Callsites[n].Line == line && Callsites[n].File == file)
+            callsite = &Callsites[n];
+    if (callsite == NULL)
+    {
+        ImGuiFrameArenaCallsite new_callsite = { file, line, 0, 0, 0, 0, 0 };
+        Callsites.push_back(new_callsite);
+        callsite = &Callsites.back();
+    }
+    callsite->AllocCount++;
+    callsite->AllocBytes += size;
+    callsite->AllocBytesMax = ImMax(callsite->AllocBytesMax, callsite->AllocBytes);
+    return ptr;
+}
+
+void ImGuiFrameArena::Reset(float current_time, float compact_timer)
+{
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FrameArena);
+    UsedBytesPrevFrame = UsedBytes;
+    UsedBytesMax = ImMax(UsedBytesMax, UsedBytes);
+    size_t capacity = 0;
+    for (int n = 0; n < Blocks.Size; n++)
+        capacity += Blocks[n].Size;
+    if (Blocks.Size > 1)
+    {
+        for (int n = 0; n < Blocks.Size; n++)
+            IM_FREE(Blocks[n].Data);
+        Blocks.resize(1);
+        Blocks[0].Size = capacity;
+        Blocks[0].Data = (char*)IM_ALLOC(capacity);
+    }
+
+    // Shrink after 'compact_timer' seconds without a frame using more than half of the capacity
+    if (UsedBytes * 2 > capacity)
+    {
+        LastTimeCapacityNeeded = current_time;
+        UsedBytesRecentMax = 0;
+    }
+    else
+    {
+        UsedBytesRecentMax = ImMax(UsedBytesRecentMax, UsedBytes);
+        if (compact_timer >= 0.0f && Blocks.Size == 1 && LastTimeCapacityNeeded <= current_time - compact_timer)
+        {
+            const size_t new_size = (UsedBytesRecentMax > 0) ? ImMax(UsedBytesRecentMax * 2, (size_t)IM_FRAME_ARENA_MIN_BLOCK_SIZE) : 0;
+            if (new_size < capacity)
+            {
+                IM_FREE(Blocks[0].Data);
+                if (new_size > 0)
+                {
+                    Blocks[0].Size = new_size;
+                    Blocks[0].Data = (char*)IM_ALLOC(new_size);
+                }
+                else
+                {
+                    Blocks.clear();
+                }
+            }
+            LastTimeCapacityNeeded = current_time;
+            UsedBytesRecentMax = 0;
+        }
+    }
+    CurrentBlock = 0;
+    CurrentOffset = UsedBytes = 0;
+    for (int n = 0; n < Callsites.Size; n++)
+    {
+        ImGuiFrameArenaCallsite& callsite = Callsites[n];
+        callsite.AllocCountPrevFrame = callsite.AllocCount;
+        callsite.AllocBytesPrevFrame = callsite.AllocBytes;
+        callsite.AllocCount = 0;
+        callsite.AllocBytes = 0;
+    }
+}
+
+void ImGuiFrameArena::ClearFreeMemory()
+{
+    for (int n = 0; n < Blocks.Size; n++)
+        IM_FREE(Blocks[n].Data);
+    Blocks.clear();
+    Callsites.clear();
+    CurrentBlock = 0;
+    CurrentOffset = UsedBytes = UsedBytesPrevFrame = UsedBytesMax = UsedBytesRecentMax = 0;
+    LastTimeCapacityNeeded = 0.0f;
+}
+
+const char* ImGui::GetClipboardText()
+{
+    ImGuiContext& g = *GImGui;
+    return g.IO.GetClipboardTextFn ? g.IO.GetClipboardTextFn(g.IO.ClipboardUserData) : "";
+}
+
+void ImGui::SetClipboardText(const char* text)
 {
     ImGuiContext& g = *GImGui;
     if (g.IO.SetClipboardTextFn)
@@ -3700,6 +4634,7 @@ void ImGui::NewFrame()
 {
     IM_ASSERT(GImGui != NULL && "No current context. Did you call ImGui::CreateContext() and ImGui::SetCurrentContext() ?");
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("NewFrame");
 
 #ifdef IMGUI_ENABLE_TEST_ENGINE
     ImGuiTestEngineHook_PreNewFrame(&g);
@@ -3714,6 +4649,14 @@ void ImGui::NewFrame()
     g.Time += g.IO.DeltaTime;
     g.WithinFrameScope = true;
     g.FrameCount += 1;
+    g.FrameArena.Reset((float)g.Time, g.IO.ConfigWindowsMemoryCompactTimer);
+#ifdef IMGUI_ENABLE_MEMORY_ACCOUNTING
+    for (int tag = 0; tag < ImGuiMemTag_COUNT; tag++)
+    {
+        g.MemTagAllocCountPrevFrame[tag] = g.MemTagAllocCount[tag] - g.MemTagAllocCountFrameStart[tag];
+        g.MemTagAllocCountFrameStart[tag] = g.MemTagAllocCount[tag];
+    }
+#endif
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
@@ -3725,7 +4668,15 @@ void ImGui::NewFrame()
     g.IO.Framerate = (g.FramerateSecPerFrameAccum > 0.0f) ? (1.0f / (g.FramerateSecPerFrameAccum / (float)IM_ARRAYSIZE(g.FramerateSecPerFrame))) : FLT_MAX;
 
     // Setup current font and draw list shared data
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+    // A shared atlas may be used concurrently by contexts on other threads, so we never write its Locked flag (see EndFrame).
+    // The application locks it once, after building it and before starting the threads.
+    if (g.FontAtlasOwnedByContext)
+        g.IO.Fonts->Locked = true;
+    IM_ASSERT(g.IO.Fonts->Locked && "With IMGUI_ENABLE_THREAD_LOCAL_CONTEXT, build the shared font atlas and set atlas->Locked = true before using it from any context.");
+#else
     g.IO.Fonts->Locked = true;
+#endif
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
     g.DrawListSharedData.ClipRectFullscreen = ImVec4(0.0f, 0.0f, g.IO.DisplaySize.x, g.IO.DisplaySize.y);
@@ -3738,6 +4689,12 @@ void ImGui::NewFrame()
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasIdxSize)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowIdxSize;
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasIdxSpans)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowIdxSpans;
+    if (g.IO.ConfigDrawListDiff && (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasDirtyRanges))
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_TrackDirtyRanges;
 
     g.BackgroundDrawList.Clear();
     g.BackgroundDrawList.PushTextureID(g.IO.Fonts->TexID);
@@ -3809,6 +4766,13 @@ void ImGui::NewFrame()
     // Update mouse input state
     UpdateMouseInputs();
 
+    // Record whether we received input events, for idle detection
+    g.IdleFrameHadInputs = (g.IO.MouseDelta.x != 0.0f || g.IO.MouseDelta.y != 0.0f || g.IO.MouseWheel != 0.0f || g.IO.MouseWheelH != 0.0f || g.IO.InputQueueCharacters.Size > 0);
+    for (int i = 0; i < IM_ARRAYSIZE(g.IO.MouseDown) && !g.IdleFrameHadInputs; i++)
+        g.IdleFrameHadInputs = g.IO.MouseClicked[i] || g.IO.MouseReleased[i];
+    for (int i = 0; i < IM_ARRAYSIZE(g.IO.KeysDown) && !g.IdleFrameHadInputs; i++)
+        g.IdleFrameHadInputs = (g.IO.KeysDownDuration[i] == 0.0f) || (g.IO.KeysDownDurationPrev[i] >= 0.0f && !g.IO.KeysDown[i]);
+
     // Find hovered window
     // (needs to be before UpdateMouseMovingWindowNewFrame so we fill g.HoveredWindowUnderMovingWindow on the mouse release frame)
     UpdateHoveredWindowAndCaptureFlags();
@@ -3824,6 +4788,7 @@ void ImGui::NewFrame()
 
     g.MouseCursor = ImGuiMouseCursor_Arrow;
     g.WantCaptureMouseNextFrame = g.WantCaptureKeyboardNextFrame = g.WantTextInputNextFrame = -1;
+    g.IO.WantSampleFramebuffer = false;
     g.PlatformImePos = ImVec2(1.0f, 1.0f); // OS Input Method Editor showing on top-left of our window by default
 
     // Mouse wheel scrolling, scale
@@ -3848,6 +4813,15 @@ void ImGui::NewFrame()
             GcCompactTransientWindowBuffers(window);
     }
 
+    // Garbage collect caches of recently unused plots (never one used in the previous frame, even with a zero timer)
+    for (int i = 0; i < g.PlotCaches.Size && g.IO.ConfigWindowsMemoryCompactTimer >= 0.0f; i++)
+        if (g.PlotCaches[i]->LastFrameActive < g.FrameCount - 1 && g.PlotCaches[i]->LastTimeActive < memory_compact_start_time)
+        {
+            IM_DELETE(g.PlotCaches[i]);
+            g.PlotCaches.erase(g.PlotCaches.Data + i);
+            i--;
+        }
+
     // Closing the focused window restore focus to the first active root window in descending z-order
     if (g.NavWindow && !g.NavWindow->WasActive)
         FocusTopMostWindowUnderOne(NULL, NULL);
@@ -3915,6 +4889,9 @@ void ImGui::Initialize(ImGuiContext* context)
         g.SettingsHandlers.push_back(ini_handler);
     }
 
+    // Add .ini handle for the palette of the color pickers
+    ColorPaletteSettingsInstallHandler(&g);
+
 #ifdef IMGUI_HAS_TABLE
     // Add .ini handle for ImGuiTable type
     {
@@ -3958,6 +4935,7 @@ void ImGui::Shutdown(ImGuiContext* context)
         SaveIniSettingsToDisk(g.IO.IniFilename);
         SetCurrentContext(backup_context);
     }
+    SettingsWriterShutdown(&g);
 
     // Clear everything else
     for (int i = 0; i < g.Windows.Size; i++)
@@ -3978,19 +4956,32 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.OpenPopupStack.clear();
     g.BeginPopupStack.clear();
     g.DrawDataBuilder.ClearFreeMemory();
+    g.FrameArena.ClearFreeMemory();
     g.BackgroundDrawList.ClearFreeMemory();
     g.ForegroundDrawList.ClearFreeMemory();
 
     g.TabBars.Clear();
     g.CurrentTabBarStack.clear();
     g.ShrinkWidthBuffer.clear();
+    for (int i = 0; i < g.PlotCaches.Size; i++)
+        IM_DELETE(g.PlotCaches[i]);
+    g.PlotCaches.clear();
+    g.TypingSelect.Labels.clear();
+    g.TypingSelect.Entries.clear();
+    g.IO.FramebufferSamplePixels.clear();
+    g.ColorHistory.Palette.clear();
+    g.ColorHistory.PaletteLookup.clear();
 
     g.ClipboardHandlerData.clear();
     g.MenusIdSubmittedThisFrame.clear();
     g.InputTextState.ClearFreeMemory();
 
     g.SettingsWindows.clear();
+    g.SettingsWindowsLookup.clear();
+    g.SettingsWindowsCount = 0;
     g.SettingsHandlers.clear();
+    g.SettingsBinaryEntries.clear();
+    g.SettingsBinaryBuf.clear();
 
     if (g.LogFile)
     {
@@ -4052,7 +5043,7 @@ static void AddDrawListToDrawData(ImVector<ImDrawList*>* out_list, ImDrawList* d
     // May trigger for you if you are using PrimXXX functions incorrectly.
     IM_ASSERT(draw_list->VtxBuffer.Size == 0 || draw_list->_VtxWritePtr == draw_list->VtxBuffer.Data + draw_list->VtxBuffer.Size);
     IM_ASSERT(draw_list->IdxBuffer.Size == 0 || draw_list->_IdxWritePtr == draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size);
-    if (!(draw_list->Flags & ImDrawListFlags_AllowVtxOffset))
+    if (!(draw_list->Flags & (ImDrawListFlags_AllowVtxOffset | ImDrawListFlags_AllowIdxSize)))
         IM_ASSERT((int)draw_list->_VtxCurrentIdx == draw_list->VtxBuffer.Size);
 
     // Check that draw_list doesn't use more vertices than indexable (default ImDrawIdx = unsigned short = 2 bytes = 64K vertices per ImDrawList = per window)
@@ -4063,16 +5054,33 @@ static void AddDrawListToDrawData(ImVector<ImDrawList*>* out_list, ImDrawList* d
     //   (A) Handle the ImDrawCmd::VtxOffset value in your renderer back-end, and set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset'.
     //       Most example back-ends already support this from 1.71. Pre-1.71 back-ends won't.
     //       Some graphics API such as GL ES 1/2 don't have a way to offset the starting vertex so it is not supported for them.
-    //   (B) Or handle 32-bit indices in your renderer back-end, and uncomment '#define ImDrawIdx unsigned int' line in imconfig.h.
+    //   (B) Or handle ImDrawList::IdxSize (16-bit or 32-bit indices) in your renderer back-end, and set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasIdxSize'.
+    //       Large lists are then submitted with 32-bit indices, with no VtxOffset, and the other lists keep 16-bit indices.
+    //   (C) Or handle 32-bit indices in your renderer back-end, and uncomment '#define ImDrawIdx unsigned int' line in imconfig.h.
     //       Most example back-ends already support this. For example, the OpenGL example code detect index size at compile-time:
     //         glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_buffer_offset);
     //       Your own engine or render API may use different parameters or function calls to specify index sizes.
+    //       Combined with (B), lists with less than 64K vertices are still submitted with 16-bit indices.
     //       2 and 4 bytes indices are generally supported by most graphics API.
     // - If for some reason neither of those solutions works for you, a workaround is to call BeginChild()/EndChild() before reaching
     //   the 64K limit to split your draw commands in multiple draw lists.
     if (sizeof(ImDrawIdx) == 2)
         IM_ASSERT(draw_list->_VtxCurrentIdx < (1 << 16) && "Too many vertices in ImDrawList using 16-bit indices. Read comment above");
 
+    // With a back-end honoring ImDrawList::IdxSpans, terminate the span list with our own trailing indices.
+    draw_list->CloseIdxSpans();
+
+    // With a back-end honoring ImDrawList::IdxSize, submit large lists with 32-bit indices and small lists with 16-bit indices.
+    if (draw_list->Flags & ImDrawListFlags_AllowIdxSize)
+    {
+        draw_list->WidenIdxBuffer();
+        draw_list->CompactIdxBuffer();
+    }
+
+    // Compare with what we submitted last frame, so the back-end can upload modified ranges only.
+    if (draw_list->Flags & ImDrawListFlags_TrackDirtyRanges)
+        draw_list->UpdateDirtyRanges();
+
     out_list->push_back(draw_list);
 }
 
@@ -4121,15 +5129,28 @@ static void SetupDrawData(ImVector<ImDrawList*>* draw_lists, ImDrawData* draw_da
     draw_data->Valid = true;
     draw_data->CmdLists = (draw_lists->Size > 0) ? draw_lists->Data : NULL;
     draw_data->CmdListsCount = draw_lists->Size;
-    draw_data->TotalVtxCount = draw_data->TotalIdxCount = 0;
+    draw_data->TotalVtxCount = draw_data->TotalIdxCount = draw_data->TotalDirtyBytes = 0;
+    draw_data->HasDirtyRanges = true;
     draw_data->DisplayPos = ImVec2(0.0f, 0.0f);
     draw_data->DisplaySize = io.DisplaySize;
     draw_data->FramebufferScale = io.DisplayFramebufferScale;
     for (int n = 0; n < draw_lists->Size; n++)
     {
-        draw_data->TotalVtxCount += draw_lists->Data[n]->VtxBuffer.Size;
-        draw_data->TotalIdxCount += draw_lists->Data[n]->IdxBuffer.Size;
+        ImDrawList* draw_list = draw_lists->Data[n];
+        draw_data->TotalVtxCount += draw_list->VtxBuffer.Size;
+        draw_data->TotalIdxCount += draw_list->GetIdxCount();
+        if (!(draw_list->Flags & ImDrawListFlags_TrackDirtyRanges))
+        {
+            draw_data->HasDirtyRanges = false;
+            continue;
+        }
+        for (int range_n = 0; range_n < draw_list->VtxDirtyRanges.Size; range_n++)
+            draw_data->TotalDirtyBytes += (int)draw_list->VtxDirtyRanges[range_n].Size;
+        for (int range_n = 0; range_n < draw_list->IdxDirtyRanges.Size; range_n++)
+            draw_data->TotalDirtyBytes += (int)draw_list->IdxDirtyRanges[range_n].Size;
     }
+    if (!draw_data->HasDirtyRanges)
+        draw_data->TotalDirtyBytes = 0;
 }
 
 // When using this function it is sane to ensure that float are perfectly rounded to integer values, to that e.g. (int)(max.x-min.x) in user's render produce correct result.
@@ -4152,6 +5173,7 @@ void ImGui::EndFrame()
 {
     ImGuiContext& g = *GImGui;
     IM_ASSERT(g.Initialized);
+    IMGUI_PROFILER_ZONE("EndFrame");
 
     // Don't process EndFrame() multiple times.
     if (g.FrameCountEnded == g.FrameCount)
@@ -4219,6 +5241,9 @@ void ImGui::EndFrame()
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
 
     // Unlock font atlas
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+    if (g.FontAtlasOwnedByContext)
+#endif
     g.IO.Fonts->Locked = false;
 
     // Clear Input data for next frame
@@ -4231,6 +5256,7 @@ void ImGui::Render()
 {
     ImGuiContext& g = *GImGui;
     IM_ASSERT(g.Initialized);
+    IMGUI_PROFILER_ZONE("Render");
 
     if (g.FrameCountEnded != g.FrameCount)
         EndFrame();
@@ -4269,6 +5295,7 @@ void ImGui::Render()
     SetupDrawData(&g.DrawDataBuilder.Layers[0], &g.DrawData);
     g.IO.MetricsRenderVertices = g.DrawData.TotalVtxCount;
     g.IO.MetricsRenderIndices = g.DrawData.TotalIdxCount;
+    g.IO.MetricsRenderDirtyBytes = g.DrawData.HasDirtyRanges ? g.DrawData.TotalDirtyBytes : -1;
 
     // (Legacy) Call the Render callback function. The current prefer way is to let the user retrieve GetDrawData() and call the render function themselves.
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
@@ -4277,6 +5304,107 @@ void ImGui::Render()
 #endif
 }
 
+// Hash everything a renderer would use from the draw data. We hash ImDrawCmd fields one by one as the structure has padding.
+static ImU32 HashDrawData(const ImDrawData* draw_data)
+{
+    ImU32 hash = ImHashData(&draw_data->DisplayPos, sizeof(ImVec2));
+    hash = ImHashData(&draw_data->DisplaySize, sizeof(ImVec2), hash);
+    hash = ImHashData(&draw_data->FramebufferScale, sizeof(ImVec2), hash);
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* draw_list = draw_data->CmdLists[n];
+        hash = ImHashData(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes(), hash);
+        if (draw_list->IdxSpans.Size == 0)
+        {
+            hash = ImHashData(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.Size * draw_list->IdxSize, hash);
+        }
+        else
+        {
+            for (int span_n = 0; span_n < draw_list->IdxSpans.Size; span_n++)
+            {
+                const ImDrawIdxSpan& span = draw_list->IdxSpans[span_n];
+                const char* span_data = (const char*)(span.Data ? span.Data : (const void*)draw_list->IdxBuffer.Data) + span.Offset * draw_list->IdxSize;
+                hash = ImHashData(span_data, (size_t)span.Count * draw_list->IdxSize, hash);
+            }
+        }
+        for (int cmd_n = 0; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+        {
+            const ImDrawCmd* cmd = &draw_list->CmdBuffer[cmd_n];
+            hash = ImHashData(&cmd->ClipRect, sizeof(cmd->ClipRect), hash);
+            hash = ImHashData(&cmd->TextureId, sizeof(cmd->TextureId), hash);
+            hash = ImHashData(&cmd->ElemCount, sizeof(cmd->ElemCount), hash);
+            hash = ImHashData(&cmd->VtxOffset, sizeof(cmd->VtxOffset), hash);
+            hash = ImHashData(&cmd->IdxOffset, sizeof(cmd->IdxOffset), hash);
+            hash = ImHashData(&cmd->UserCallback, sizeof(cmd->UserCallback), hash);
+            hash = ImHashData(&cmd->UserCallbackData, sizeof(cmd->UserCallbackData), hash);
+        }
+    }
+    return hash;
+}
+
+// Idle detection.
+// - Comparing the draw data with the one of the previous checked frame generically catches anything animated (which changes the output).
+// - Then we look for state which is going to change the output in a future frame without the help of an input event.
+// - The result is cached for the frame, as we can only compare hashes once.
+float ImGui::GetIdleWaitTime()
+{
+    ImGuiContext& g = *GImGui;
+    if (!g.DrawData.Valid)
+        return 0.0f;
+    if (g.IdleCheckFrame == g.FrameCount)
+        return g.IdleCheckWaitTime;
+
+    const ImU32 draw_data_hash = HashDrawData(&g.DrawData);
+    const bool output_changed = (draw_data_hash != g.IdleDrawDataHash) || (g.IdleCheckFrame != g.FrameCount - 1);
+    g.IdleCheckFrame = g.FrameCount;
+    g.IdleDrawDataHash = draw_data_hash;
+    g.IdleCheckWaitTime = 0.0f;
+    if (output_changed || g.IdleFrameHadInputs)
+        return 0.0f;
+
+    // Held inputs (key repeat, repeating buttons, moving/resizing windows), pending navigation and drag and drop
+    for (int i = 0; i < IM_ARRAYSIZE(g.IO.MouseDown); i++)
+        if (g.IO.MouseDown[i])
+            return 0.0f;
+    for (int i = 0; i < IM_ARRAYSIZE(g.IO.KeysDown); i++)
+        if (g.IO.KeysDown[i])
+            return 0.0f;
+    for (int i = 0; i < IM_ARRAYSIZE(g.IO.NavInputsDownDuration); i++)
+        if (g.IO.NavInputsDownDuration[i] >= 0.0f)
+            return 0.0f;
+    if (g.NavMoveRequest || g.NavInitRequest || g.NavWindowingTarget != NULL || g.FocusRequestNextWindow != NULL || g.DragDropActive || g.IO.WantSetMousePos)
+        return 0.0f;
+
+    // Windows being laid out over multiple frames (appearing, auto-fitting, scrolling to a target)
+    for (int n = 0; n < g.Windows.Size; n++)
+    {
+        ImGuiWindow* window = g.Windows[n];
+        if (!window->WasActive)
+            continue;
+        if (window->HiddenFramesCanSkipItems > 0 || window->HiddenFramesCannotSkipItems > 0 || window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0 || window->ScrollTarget.x < FLT_MAX || window->ScrollTarget.y < FLT_MAX)
+            return 0.0f;
+    }
+
+    // Timers
+    float wait_time = FLT_MAX;
+    if (g.ActiveId != 0 && g.InputTextState.ID == g.ActiveId && g.IO.ConfigInputTextCursorBlink)
+    {
+        // Text cursor blink (visible when CursorAnim <= 0.0f or ImFmod(CursorAnim, 1.20f) <= 0.80f, see InputTextEx())
+        const float t = g.InputTextState.CursorAnim;
+        const float t_mod = (t <= 0.0f) ? t : ImFmod(t, 1.20f);
+        wait_time = ImMin(wait_time, (t_mod <= 0.80f) ? 0.80f - t_mod : 1.20f - t_mod);
+    }
+    if (g.SettingsDirtyTimer > 0.0f)
+        wait_time = ImMin(wait_time, g.SettingsDirtyTimer);
+    g.IdleCheckWaitTime = wait_time;
+    return wait_time;
+}
+
+bool ImGui::IsFrameIdle()
+{
+    return GetIdleWaitTime() > 0.0f;
+}
+
 // Calculate text size. Text can be multi-line. Optionally ignore text after a ## marker.
 // CalcTextSize("") should return ImVec2(0.0f, g.FontSize)
 ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_text_after_double_hash, float wrap_width)
@@ -4697,7 +5825,7 @@ static ImRect GetViewportRect()
     return ImRect(0.0f, 0.0f, g.IO.DisplaySize.x, g.IO.DisplaySize.y);
 }
 
-bool ImGui::BeginChildEx(const char* name, ImGuiID id, const ImVec2& size_arg, bool border, ImGuiWindowFlags flags)
+bool ImGui::BeginChildEx(const char* name, ImGuiID id, const ImVec2& size_arg, bool border, ImGuiWindowFlags flags, ImGuiWindowHandle* handle)
 {
     ImGuiContext& g = *GImGui;
     ImGuiWindow* parent_window = g.CurrentWindow;
@@ -4716,19 +5844,26 @@ bool ImGui::BeginChildEx(const char* name, ImGuiID id, const ImVec2& size_arg, b
     SetNextWindowSize(size);
 
     // Build up name. If you need to append to a same child from multiple location in the ID stack, use BeginChild(ImGuiID id) with a stable value.
+    // With an interned handle, the name was already built by the first call.
     char title[256];
-    if (name)
-        ImFormatString(title, IM_ARRAYSIZE(title), "%s/%s_%08X", parent_window->Name, name, id);
-    else
-        ImFormatString(title, IM_ARRAYSIZE(title), "%s/%08X", parent_window->Name, id);
+    ImGuiWindow* child_window = handle ? *handle : NULL;
+    if (child_window == NULL)
+    {
+        if (name)
+            ImFormatString(title, IM_ARRAYSIZE(title), "%s/%s_%08X", parent_window->Name, name, id);
+        else
+            ImFormatString(title, IM_ARRAYSIZE(title), "%s/%08X", parent_window->Name, id);
+    }
 
     const float backup_border_size = g.Style.ChildBorderSize;
     if (!border)
         g.Style.ChildBorderSize = 0.0f;
-    bool ret = Begin(title, NULL, flags);
+    bool ret = BeginEx(child_window ? child_window->Name : title, child_window, NULL, flags);
     g.Style.ChildBorderSize = backup_border_size;
 
-    ImGuiWindow* child_window = g.CurrentWindow;
+    child_window = g.CurrentWindow;
+    if (handle)
+        *handle = child_window;
     child_window->ChildId = id;
     child_window->AutoFitChildAxises = (ImS8)auto_fit_axises;
 
@@ -4754,6 +5889,24 @@ bool ImGui::BeginChild(const char* str_id, const ImVec2& size_arg, bool border,
     return BeginChildEx(str_id, window->GetID(str_id), size_arg, border, extra_flags);
 }
 
+bool ImGui::BeginChild(ImGuiWindowHandle* handle, const char* str_id, const ImVec2& size_arg, bool border, ImGuiWindowFlags extra_flags)
+{
+    IM_ASSERT(handle != NULL);
+    ImGuiWindow* window = GetCurrentWindow();
+    ImGuiID id;
+    if (ImGuiWindow* child_window = *handle)
+    {
+        id = child_window->ChildId;
+        IM_ASSERT_PARANOID(id == window->GetIDNoKeepAlive(str_id));
+        KeepAliveID(id);
+    }
+    else
+    {
+        id = window->GetID(str_id);
+    }
+    return BeginChildEx(str_id, id, size_arg, border, extra_flags, handle);
+}
+
 bool ImGui::BeginChild(ImGuiID id, const ImVec2& size_arg, bool border, ImGuiWindowFlags extra_flags)
 {
     IM_ASSERT(id != 0);
@@ -4844,6 +5997,7 @@ ImGuiWindow* ImGui::FindWindowByName(const char* name)
 
 static ImGuiWindow* CreateNewWindow(const char* name, ImVec2 size, ImGuiWindowFlags flags)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Windows);
     ImGuiContext& g = *GImGui;
     //IMGUI_DEBUG_LOG("CreateNewWindow '%s', flags = 0x%08X\n", name, flags);
 
@@ -5404,6 +6558,21 @@ void ImGui::UpdateWindowParentAndRootLinks(ImGuiWindow* window, ImGuiWindowFlags
 // - Passing 'bool* p_open' displays a Close button on the upper-right corner of the window, the pointed value will be set to false when the button is pressed.
 bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 {
+    return BeginEx(name, NULL, p_open, flags);
+}
+
+bool ImGui::Begin(ImGuiWindowHandle* handle, const char* name, bool* p_open, ImGuiWindowFlags flags)
+{
+    IM_ASSERT(handle != NULL);
+    bool ret = BeginEx(name, *handle, p_open, flags);
+    *handle = GImGui->CurrentWindow;
+    return ret;
+}
+
+bool ImGui::BeginEx(const char* name, ImGuiWindow* window, bool* p_open, ImGuiWindowFlags flags)
+{
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Windows);
+    IMGUI_PROFILER_ZONE("Begin");
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
     IM_ASSERT(name != NULL && name[0] != '\0');     // Window name required
@@ -5411,7 +6580,9 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     IM_ASSERT(g.FrameCountEnded != g.FrameCount);   // Called ImGui::Render() or ImGui::EndFrame() and haven't called ImGui::NewFrame() again yet
 
     // Find or create
-    ImGuiWindow* window = FindWindowByName(name);
+    if (window == NULL)
+        window = FindWindowByName(name);
+    IM_ASSERT_PARANOID(window == FindWindowByName(name));   // Interned handle used with another name or context
     const bool window_just_created = (window == NULL);
     if (window_just_created)
     {
@@ -6167,6 +7338,7 @@ void ImGui::SetCurrentFont(ImFont* font)
 
     ImFontAtlas* atlas = g.Font->ContainerAtlas;
     g.DrawListSharedData.TexUvWhitePixel = atlas->TexUvWhitePixel;
+    g.DrawListSharedData.TexUvCheckerboard = atlas->TexUvCheckerboard;
     g.DrawListSharedData.Font = g.Font;
     g.DrawListSharedData.FontSize = g.FontSize;
 }
@@ -6626,24 +7798,28 @@ ImGuiStorage* ImGui::GetStateStorage()
 
 void ImGui::PushID(const char* str_id)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Windows);
     ImGuiWindow* window = GImGui->CurrentWindow;
     window->IDStack.push_back(window->GetIDNoKeepAlive(str_id));
 }
 
 void ImGui::PushID(const char* str_id_begin, const char* str_id_end)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Windows);
     ImGuiWindow* window = GImGui->CurrentWindow;
     window->IDStack.push_back(window->GetIDNoKeepAlive(str_id_begin, str_id_end));
 }
 
 void ImGui::PushID(const void* ptr_id)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Windows);
     ImGuiWindow* window = GImGui->CurrentWindow;
     window->IDStack.push_back(window->GetIDNoKeepAlive(ptr_id));
 }
 
 void ImGui::PushID(int int_id)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Windows);
     ImGuiWindow* window = GImGui->CurrentWindow;
     window->IDStack.push_back(window->GetIDNoKeepAlive(int_id));
 }
@@ -6651,10 +7827,17 @@ void ImGui::PushID(int int_id)
 // Push a given id value ignoring the ID stack as a seed.
 void ImGui::PushOverrideID(ImGuiID id)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Windows);
     ImGuiWindow* window = GImGui->CurrentWindow;
     window->IDStack.push_back(id);
 }
 
+// Public version of PushOverrideID(), for an id returned by GetID() in the same ID stack context.
+void ImGui::PushIDPrecomputed(ImGuiID id)
+{
+    PushOverrideID(id);
+}
+
 void ImGui::PopID()
 {
     ImGuiWindow* window = GImGui->CurrentWindow;
@@ -6879,6 +8062,7 @@ void ImGui::ItemSize(const ImRect& bb, float text_baseline_y)
 // declare their minimum size requirement to ItemSize() and provide a larger region to ItemAdd() which is used drawing/interaction.
 bool ImGui::ItemAdd(const ImRect& bb, ImGuiID id, const ImRect* nav_bb_arg)
 {
+    IMGUI_PROFILER_ZONE("ItemAdd");
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = g.CurrentWindow;
 
@@ -9547,6 +10731,10 @@ void ImGui::UpdateSettings()
         g.SettingsLoaded = true;
     }
 
+    // Free the files written by the background writer thread
+    if (g.SettingsWriter != NULL)
+        SettingsWriterCollect(&g);
+
     // Save settings (with a delay after the last modification, so we don't spam disk too much)
     if (g.SettingsDirtyTimer > 0.0f)
     {
@@ -9577,8 +10765,18 @@ void ImGui::MarkIniSettingsDirty(ImGuiWindow* window)
             g.SettingsDirtyTimer = g.IO.IniSavingRate;
 }
 
+static void SettingsWindowsLookupInsert(ImGuiContext& g, ImGuiWindowSettings* settings)
+{
+    const int mask = g.SettingsWindowsLookup.Size - 1;
+    int slot = (int)(settings->ID & (ImU32)mask);
+    while (g.SettingsWindowsLookup.Data[slot] != 0)
+        slot = (slot + 1) & mask;
+    g.SettingsWindowsLookup.Data[slot] = g.SettingsWindows.offset_from_ptr(settings) + 1;
+}
+
 ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Settings);
     ImGuiContext& g = *GImGui;
 
 #if !IMGUI_DEBUG_INI_SETTINGS
@@ -9596,15 +10794,35 @@ ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
     settings->ID = ImHashStr(name, name_len);
     memcpy(settings->GetName(), name, name_len + 1);   // Store with zero terminator
 
+    // Add to lookup table, keeping it at most half full
+    g.SettingsWindowsCount++;
+    if (g.SettingsWindowsCount * 2 > g.SettingsWindowsLookup.Size)
+    {
+        g.SettingsWindowsLookup.resize(ImMax(g.SettingsWindowsLookup.Size * 2, 64));
+        memset(g.SettingsWindowsLookup.Data, 0, (size_t)g.SettingsWindowsLookup.size_in_bytes());
+        for (ImGuiWindowSettings* it = g.SettingsWindows.begin(); it != NULL; it = g.SettingsWindows.next_chunk(it))
+            SettingsWindowsLookupInsert(g, it);
+    }
+    else
+    {
+        SettingsWindowsLookupInsert(g, settings);
+    }
+
     return settings;
 }
 
 ImGuiWindowSettings* ImGui::FindWindowSettings(ImGuiID id)
 {
     ImGuiContext& g = *GImGui;
-    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
+    if (g.SettingsWindowsLookup.empty())
+        return NULL;
+    const int mask = g.SettingsWindowsLookup.Size - 1;
+    for (int slot = (int)(id & (ImU32)mask); g.SettingsWindowsLookup.Data[slot] != 0; slot = (slot + 1) & mask)
+    {
+        ImGuiWindowSettings* settings = g.SettingsWindows.ptr_from_offset(g.SettingsWindowsLookup.Data[slot] - 1);
         if (settings->ID == id)
             return settings;
+    }
     return NULL;
 }
 
@@ -9617,11 +10835,18 @@ ImGuiWindowSettings* ImGui::FindOrCreateWindowSettings(const char* name)
 
 void ImGui::LoadIniSettingsFromDisk(const char* ini_filename)
 {
+    ImGuiContext& g = *GImGui;
     size_t file_data_size = 0;
-    char* file_data = (char*)ImFileLoadToMemory(ini_filename, "rb", &file_data_size);
+    char* file_data = (char*)ImFileLoadToMemory(ini_filename, "rb", &file_data_size, 1);
     if (!file_data)
         return;
-    LoadIniSettingsFromMemory(file_data, (size_t)file_data_size);
+    if (!LoadIniSettingsFromBinary(&g, file_data, file_data_size))
+    {
+        if (file_data_size > 0)
+            LoadIniSettingsFromMemoryInPlace(file_data, file_data_size);
+        g.SettingsBinaryEntries.resize(0);
+        g.SettingsBinaryFileSize = g.SettingsBinaryLiveSize = 0;
+    }
     IM_FREE(file_data);
 }
 
@@ -9638,35 +10863,45 @@ ImGuiSettingsHandler* ImGui::FindSettingsHandler(const char* type_name)
 // Zero-tolerance, no error reporting, cheap .ini parsing
 void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
 {
-    ImGuiContext& g = *GImGui;
-    IM_ASSERT(g.Initialized);
-    IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Settings);
 
     // For user convenience, we allow passing a non zero-terminated string (hence the ini_size parameter).
-    // For our convenience and to make the code simpler, we'll also write zero-terminators within the buffer. So let's create a writable copy..
+    // The parser writes zero-terminators within the buffer, so let's create a writable copy.
+    // (LoadIniSettingsFromDisk() parses the buffer it loaded in place)
     if (ini_size == 0)
         ini_size = strlen(ini_data);
     char* buf = (char*)IM_ALLOC(ini_size + 1);
-    char* buf_end = buf + ini_size;
     memcpy(buf, ini_data, ini_size);
     buf[ini_size] = 0;
+    LoadIniSettingsFromMemoryInPlace(buf, ini_size);
+    IM_FREE(buf);
+}
+
+// Single pass: each line is terminated in place and passed to its handler.
+void ImGui::LoadIniSettingsFromMemoryInPlace(char* ini_data, size_t ini_size)
+{
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Settings);
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.Initialized);
+    IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
 
     void* entry_data = NULL;
     ImGuiSettingsHandler* entry_handler = NULL;
 
-    char* line_end = NULL;
-    for (char* line = buf; line < buf_end; line = line_end + 1)
+    char* buf_end = ini_data + ini_size;
+    char* line_next = NULL;
+    for (char* line = ini_data; line < buf_end; line = line_next)
     {
-        // Skip new lines markers, then find end of the line
-        while (*line == '\n' || *line == '\r')
-            line++;
-        line_end = line;
+        // Find end of the line, skipping empty lines (e.g. the second half of a \r\n pair) and comments
+        char* line_end = line;
         while (line_end < buf_end && *line_end != '\n' && *line_end != '\r')
             line_end++;
+        line_next = line_end + 1;
         line_end[0] = 0;
-        if (line[0] == ';')
+        if (line == line_end || line[0] == ';')
             continue;
-        if (line[0] == '[' && line_end > line && line_end[-1] == ']')
+
+        if (line[0] == '[' && line_end[-1] == ']')
         {
             // Parse "[Type][Name]". Note that 'Name' can itself contains [] characters, which is acceptable with the current format and parsing code.
             line_end[-1] = 0;
@@ -9678,7 +10913,10 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
                 continue;
             *type_end = 0; // Overwrite first ']'
             name_start++;  // Skip second '['
-            entry_handler = FindSettingsHandler(type_start);
+
+            // Entries of a same type are usually contiguous: only look up the handler when the type changes
+            if (entry_handler == NULL || strcmp(type_start, entry_handler->TypeName) != 0)
+                entry_handler = FindSettingsHandler(type_start);
             entry_data = entry_handler ? entry_handler->ReadOpenFn(&g, entry_handler, name_start) : NULL;
         }
         else if (entry_handler != NULL && entry_data != NULL)
@@ -9687,8 +10925,12 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
             entry_handler->ReadLineFn(&g, entry_handler, entry_data, line);
         }
     }
-    IM_FREE(buf);
     g.SettingsLoaded = true;
+
+    // Call post-read handlers
+    for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
+        if (g.SettingsHandlers[handler_n].ApplyAllFn)
+            g.SettingsHandlers[handler_n].ApplyAllFn(&g, &g.SettingsHandlers[handler_n]);
 }
 
 void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
@@ -9700,16 +10942,16 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
 
     size_t ini_data_size = 0;
     const char* ini_data = SaveIniSettingsToMemory(&ini_data_size);
-    ImFileHandle f = ImFileOpen(ini_filename, "wt");
-    if (!f)
-        return;
-    ImFileWrite(ini_data, sizeof(char), ini_data_size, f);
-    ImFileClose(f);
+    if (g.IO.IniBinaryFormat)
+        SaveIniSettingsToBinary(&g, ini_filename, ini_data, ini_data_size);
+    else
+        SettingsWriteOrEnqueue(&g, ini_filename, ini_data, ini_data_size, "wt", 0);
 }
 
 // Call registered handlers (e.g. SettingsHandlerWindow_WriteAll() + custom handlers) to write their stuff into a text buffer
 const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Settings);
     ImGuiContext& g = *GImGui;
     g.SettingsDirtyTimer = 0.0f;
     g.SettingsIniData.Buf.resize(0);
@@ -9724,6 +10966,406 @@ const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
     return g.SettingsIniData.c_str();
 }
 
+//-----------------------------------------------------------------------------
+// Binary .ini format (io.IniBinaryFormat)
+//-----------------------------------------------------------------------------
+// - Header: "IMGUIINI" + ImU32 version.
+// - Followed by a log of records: ImU32 key, ImU32 size, ImU32 checksum, then 'size' bytes of text.
+//   The text is the entry as written by its handler ("[Type][Name]" line included), the key is the hash of the "[Type][Name]" line.
+//   A record supersedes the previous records with the same key. A record with a size of 0 removes the entry.
+// - Saving appends records for the entries which were added, modified or removed since the last save. The file is rewritten
+//   when superseded records take more space than live ones, or when the file on disk isn't the one we last loaded/wrote.
+// - Loading stops at the first truncated or corrupted record (e.g. application killed while appending), the file is then rewritten on next save.
+// - Integers are stored in native byte order.
+//-----------------------------------------------------------------------------
+
+static const char   IMGUI_INI_BINARY_MAGIC[] = "IMGUIINI";
+static const ImU32  IMGUI_INI_BINARY_VERSION = 1;
+static const size_t IMGUI_INI_BINARY_HEADER_SIZE = 8 + 4;
+static const size_t IMGUI_INI_BINARY_RECORD_HEADER_SIZE = 4 * 3;
+
+static int IMGUI_CDECL SettingsBinaryEntryComparerByKey(const void* lhs, const void* rhs)
+{
+    const ImGuiID a = ((const ImGuiSettingsBinaryEntry*)lhs)->Key;
+    const ImGuiID b = ((const ImGuiSettingsBinaryEntry*)rhs)->Key;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+static void SettingsBinaryAppendRecord(ImVector<char>* buf, ImGuiID key, const char* data, ImU32 size)
+{
+    const ImU32 header[3] = { key, size, ImHashData(data, size, key) };
+    const int offset = buf->Size;
+    buf->resize(offset + (int)(IMGUI_INI_BINARY_RECORD_HEADER_SIZE + size));
+    memcpy(buf->Data + offset, header, IMGUI_INI_BINARY_RECORD_HEADER_SIZE);
+    if (size > 0)
+        memcpy(buf->Data + offset + IMGUI_INI_BINARY_RECORD_HEADER_SIZE, data, size);
+}
+
+// Return false if the file isn't a binary .ini file
+static bool LoadIniSettingsFromBinary(ImGuiContext* ctx, const char* file_data, size_t file_data_size)
+{
+    ImGuiContext& g = *ctx;
+    if (file_data_size < IMGUI_INI_BINARY_HEADER_SIZE || memcmp(file_data, IMGUI_INI_BINARY_MAGIC, 8) != 0)
+        return false;
+    g.SettingsBinaryEntries.resize(0);
+    g.SettingsBinaryFileSize = g.SettingsBinaryLiveSize = 0;
+    ImU32 version = 0;
+    memcpy(&version, file_data + 8, 4);
+    if (version != IMGUI_INI_BINARY_VERSION)
+        return true;
+
+    // Replay the log. Entries keep the position of their first record, so the text we rebuild keeps the order of the handlers.
+    ImVector<ImGuiSettingsBinaryEntry> entries;
+    ImGuiStorage entries_index;
+    const char* p = file_data + IMGUI_INI_BINARY_HEADER_SIZE;
+    const char* p_end = file_data + file_data_size;
+    while ((size_t)(p_end - p) >= IMGUI_INI_BINARY_RECORD_HEADER_SIZE)
+    {
+        ImU32 header[3];
+        memcpy(header, p, IMGUI_INI_BINARY_RECORD_HEADER_SIZE);
+        const char* text = p + IMGUI_INI_BINARY_RECORD_HEADER_SIZE;
+        if ((size_t)(p_end - text) < header[1] || ImHashData(text, header[1], header[0]) != header[2])
+            break;
+        int* entry_idx = entries_index.GetIntRef(header[0], -1);
+        if (*entry_idx == -1)
+        {
+            *entry_idx = entries.Size;
+            entries.resize(entries.Size + 1);
+        }
+        ImGuiSettingsBinaryEntry& entry = entries[*entry_idx];
+        entry.Key = header[0];
+        entry.Hash = header[2];
+        entry.Size = header[1];
+        entry.Offset = (ImU32)(text - file_data);
+        p = text + header[1];
+    }
+
+    ImVector<char> ini_data;
+    for (int n = 0; n < entries.Size; n++)
+        if (entries[n].Size > 0)
+        {
+            ini_data.resize(ini_data.Size + (int)entries[n].Size);
+            memcpy(ini_data.Data + ini_data.Size - entries[n].Size, file_data + entries[n].Offset, entries[n].Size);
+        }
+    if (ini_data.Size > 0)
+    {
+        ini_data.push_back(0);
+        ImGui::LoadIniSettingsFromMemoryInPlace(ini_data.Data, (size_t)ini_data.Size - 1);
+    }
+
+    // Keep track of what is on disk, so the next save only appends modified entries
+    g.SettingsBinaryLiveSize = IMGUI_INI_BINARY_HEADER_SIZE;
+    for (int n = 0; n < entries.Size; n++)
+        if (entries[n].Size > 0)
+        {
+            g.SettingsBinaryEntries.push_back(entries[n]);
+            g.SettingsBinaryLiveSize += IMGUI_INI_BINARY_RECORD_HEADER_SIZE + entries[n].Size;
+        }
+    if (g.SettingsBinaryEntries.Size > 1)
+        ImQsort(g.SettingsBinaryEntries.Data, (size_t)g.SettingsBinaryEntries.Size, sizeof(ImGuiSettingsBinaryEntry), SettingsBinaryEntryComparerByKey);
+    g.SettingsBinaryFileSize = (p == p_end) ? (ImU64)file_data_size : 0;
+    return true;
+}
+
+static void SaveIniSettingsToBinary(ImGuiContext* ctx, const char* ini_filename, const char* ini_data, size_t ini_data_size)
+{
+    ImGuiContext& g = *ctx;
+
+    // Split text into entries, each starting with a "[Type][Name]" line
+    ImVector<ImGuiSettingsBinaryEntry> entries;
+    const char* ini_data_end = ini_data + ini_data_size;
+    for (const char* line = ini_data; line < ini_data_end; )
+    {
+        const char* line_end = (const char*)memchr(line, '\n', (size_t)(ini_data_end - line));
+        line_end = line_end ? line_end + 1 : ini_data_end;
+        if (line[0] == '[')
+        {
+            ImGuiSettingsBinaryEntry entry;
+            entry.Key = ImHashData(line, (size_t)(line_end - line));
+            entry.Offset = (ImU32)(line - ini_data);
+            entries.push_back(entry);
+        }
+        if (!entries.empty())
+            entries.back().Size = (ImU32)(line_end - ini_data) - entries.back().Offset;
+        line = line_end;
+    }
+    ImU64 live_size = IMGUI_INI_BINARY_HEADER_SIZE;
+    for (int n = 0; n < entries.Size; n++)
+    {
+        ImGuiSettingsBinaryEntry& entry = entries[n];
+        entry.Hash = ImHashData(ini_data + entry.Offset, entry.Size, entry.Key);
+        live_size += IMGUI_INI_BINARY_RECORD_HEADER_SIZE + entry.Size;
+    }
+    if (entries.Size > 1)
+        ImQsort(entries.Data, (size_t)entries.Size, sizeof(ImGuiSettingsBinaryEntry), SettingsBinaryEntryComparerByKey);
+
+    // Append records for new and modified entries, and empty records for removed entries
+    ImVector<char>& buf = g.SettingsBinaryBuf;
+    buf.resize(0);
+    if (g.SettingsBinaryFileSize != 0)
+    {
+        const ImGuiSettingsBinaryEntry* old_entry = g.SettingsBinaryEntries.begin();
+        const ImGuiSettingsBinaryEntry* old_entry_end = g.SettingsBinaryEntries.end();
+        for (int n = 0; n < entries.Size || old_entry < old_entry_end; )
+        {
+            const ImGuiSettingsBinaryEntry* new_entry = (n < entries.Size) ? &entries[n] : NULL;
+            if (old_entry < old_entry_end && (new_entry == NULL || old_entry->Key < new_entry->Key))
+            {
+                SettingsBinaryAppendRecord(&buf, old_entry->Key, NULL, 0);
+                old_entry++;
+                continue;
+            }
+            const bool same_key = (old_entry < old_entry_end && old_entry->Key == new_entry->Key);
+            if (!same_key || old_entry->Hash != new_entry->Hash || old_entry->Size != new_entry->Size)
+                SettingsBinaryAppendRecord(&buf, new_entry->Key, ini_data + new_entry->Offset, new_entry->Size);
+            if (same_key)
+                old_entry++;
+            n++;
+        }
+    }
+
+    // Rewrite the whole file when we don't know its content, when it gets too fragmented, or when appending failed
+    const ImU64 file_size = g.SettingsBinaryFileSize + (ImU64)buf.Size;
+    bool rewrite = (g.SettingsBinaryFileSize == 0 || file_size > live_size * 2 + 4096);
+    if (!rewrite && buf.Size > 0)
+    {
+        if (SettingsWriteOrEnqueue(&g, ini_filename, buf.Data, (size_t)buf.Size, "ab", g.SettingsBinaryFileSize))
+            g.SettingsBinaryFileSize = file_size;
+        else
+            rewrite = true;
+    }
+    if (rewrite)
+    {
+        buf.resize(0);
+        buf.resize((int)IMGUI_INI_BINARY_HEADER_SIZE);
+        memcpy(buf.Data, IMGUI_INI_BINARY_MAGIC, 8);
+        memcpy(buf.Data + 8, &IMGUI_INI_BINARY_VERSION, 4);
+        for (int n = 0; n < entries.Size; n++)
+            SettingsBinaryAppendRecord(&buf, entries[n].Key, ini_data + entries[n].Offset, entries[n].Size);
+        g.SettingsBinaryFileSize = SettingsWriteOrEnqueue(&g, ini_filename, buf.Data, (size_t)buf.Size, "wb", 0) ? live_size : 0;
+    }
+    g.SettingsBinaryLiveSize = live_size;
+    g.SettingsBinaryEntries.swap(entries);
+}
+
+//-----------------------------------------------------------------------------
+// Writing .ini files
+//-----------------------------------------------------------------------------
+// - "wt"/"wb" mode: write to "<filename>.tmp" then rename it over 'filename', so a crash never leaves a truncated file behind.
+//   (With IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS we can't assume the file handles are FILE*, so we write to 'filename' directly.)
+// - "ab" mode: append to the file, which must be 'expected_file_size' bytes long.
+//   Otherwise the file was modified behind our back, and we fail so the caller rewrites the whole file.
+// - With io.IniSaveInBackground and IMGUI_ENABLE_SETTINGS_THREAD, files are written in order by a thread owned by the context.
+//   SettingsWriteFile() doesn't touch the context and doesn't allocate (on Windows: unless the path is very long).
+//-----------------------------------------------------------------------------
+
+static bool SettingsReplaceFile(const char* src_filename, const char* dst_filename)
+{
+#if defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS)
+    IM_UNUSED(src_filename);
+    IM_UNUSED(dst_filename);
+    return false;
+#elif defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+    wchar_t src_wbuf[512], dst_wbuf[512];
+    if (!::MultiByteToWideChar(CP_UTF8, 0, src_filename, -1, src_wbuf, IM_ARRAYSIZE(src_wbuf)) || !::MultiByteToWideChar(CP_UTF8, 0, dst_filename, -1, dst_wbuf, IM_ARRAYSIZE(dst_wbuf)))
+        return false;
+    return ::MoveFileExW(src_wbuf, dst_wbuf, MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    return rename(src_filename, dst_filename) == 0; // Atomic on POSIX. Fails on Windows if the destination exists.
+#endif
+}
+
+static bool SettingsWriteFile(const char* filename, const char* data, size_t data_size, const char* mode, ImU64 expected_file_size)
+{
+    if (mode[0] == 'a')
+    {
+        ImFileHandle f = ImFileOpen(filename, mode);
+        if (!f)
+            return false;
+        const bool ok = ImFileGetSize(f) == expected_file_size && ImFileWrite(data, sizeof(char), data_size, f) == data_size;
+        return ImFileClose(f) && ok;
+    }
+
+    // Write to a temporary file then rename it
+    char tmp_filename[512];
+#ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
+    const bool use_tmp = ImFormatString(tmp_filename, IM_ARRAYSIZE(tmp_filename), "%s.tmp", filename) < IM_ARRAYSIZE(tmp_filename) - 1;
+#else
+    const bool use_tmp = false;
+#endif
+    ImFileHandle f = ImFileOpen(use_tmp ? tmp_filename : filename, mode);
+    if (!f)
+        return false;
+    bool ok = ImFileWrite(data, sizeof(char), data_size, f) == data_size;
+    ok = ImFileClose(f) && ok;
+    if (use_tmp && ok && !SettingsReplaceFile(tmp_filename, filename))
+    {
+        // Fallback for file systems without rename (the temporary file is left behind)
+        if ((f = ImFileOpen(filename, mode)) == NULL)
+            return false;
+        ok = ImFileWrite(data, sizeof(char), data_size, f) == data_size;
+        ok = ImFileClose(f) && ok;
+    }
+    return ok;
+}
+
+#ifdef IMGUI_ENABLE_SETTINGS_THREAD
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+struct ImGuiSettingsWriteJob
+{
+    ImGuiSettingsWriteJob*  Next;
+    const char*             Filename;           // Stored after the structure
+    const char*             Data;               // Stored after Filename
+    size_t                  DataSize;
+    const char*             Mode;               // "wt", "wb" or "ab"
+    ImU64                   ExpectedFileSize;   // For "ab" mode
+    bool                    Failed;
+};
+
+struct ImGuiSettingsWriter
+{
+    std::thread             Thread;
+    std::mutex              Mutex;
+    std::condition_variable Cond;
+    ImGuiSettingsWriteJob*  PendingFirst;       // Queue of jobs to write, in order
+    ImGuiSettingsWriteJob*  PendingLast;
+    ImGuiSettingsWriteJob*  Done;               // Jobs written, to be freed by the main thread
+    int                     JobsInFlight;       // Jobs queued and not freed yet. Only accessed by the main thread.
+    bool                    Quit;
+
+    ImGuiSettingsWriter()   { PendingFirst = PendingLast = Done = NULL; JobsInFlight = 0; Quit = false; }
+};
+
+static void SettingsWriterThreadMain(ImGuiSettingsWriter* writer)
+{
+    std::unique_lock<std::mutex> lock(writer->Mutex);
+    for (;;)
+    {
+        while (writer->PendingFirst == NULL && !writer->Quit)
+            writer->Cond.wait(lock);
+        ImGuiSettingsWriteJob* job = writer->PendingFirst;
+        if (job == NULL)
+            break;
+        writer->PendingFirst = job->Next;
+        if (writer->PendingFirst == NULL)
+            writer->PendingLast = NULL;
+        lock.unlock();
+        job->Failed = !SettingsWriteFile(job->Filename, job->Data, job->DataSize, job->Mode, job->ExpectedFileSize);
+        lock.lock();
+        job->Next = writer->Done;
+        writer->Done = job;
+    }
+}
+
+static bool SettingsWriterEnqueue(ImGuiContext* ctx, const char* filename, const char* data, size_t data_size, const char* mode, ImU64 expected_file_size)
+{
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Settings);
+    ImGuiContext& g = *ctx;
+    if (g.SettingsWriter == NULL)
+    {
+        g.SettingsWriter = IM_NEW(ImGuiSettingsWriter)();
+        g.SettingsWriter->Thread = std::thread(SettingsWriterThreadMain, g.SettingsWriter);
+    }
+
+    const size_t filename_size = strlen(filename) + 1;
+    ImGuiSettingsWriteJob* job = (ImGuiSettingsWriteJob*)IM_ALLOC(sizeof(ImGuiSettingsWriteJob) + filename_size + data_size);
+    char* job_filename = (char*)(job + 1);
+    memcpy(job_filename, filename, filename_size);
+    memcpy(job_filename + filename_size, data, data_size);
+    job->Next = NULL;
+    job->Filename = job_filename;
+    job->Data = job_filename + filename_size;
+    job->DataSize = data_size;
+    job->Mode = mode;
+    job->ExpectedFileSize = expected_file_size;
+    job->Failed = false;
+
+    ImGuiSettingsWriter* writer = g.SettingsWriter;
+    {
+        std::lock_guard<std::mutex> lock(writer->Mutex);
+        if (writer->PendingLast)
+            writer->PendingLast->Next = job;
+        else
+            writer->PendingFirst = job;
+        writer->PendingLast = job;
+    }
+    writer->Cond.notify_one();
+    writer->JobsInFlight++;
+    return true;
+}
+
+static void SettingsWriterCollect(ImGuiContext* ctx)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiSettingsWriter* writer = g.SettingsWriter;
+    if (writer->JobsInFlight == 0)
+        return;
+    ImGuiSettingsWriteJob* job;
+    {
+        std::lock_guard<std::mutex> lock(writer->Mutex);
+        job = writer->Done;
+        writer->Done = NULL;
+    }
+    while (job != NULL)
+    {
+        // A failed append means the file on disk isn't what we think it is: rewrite it whole.
+        ImGuiSettingsWriteJob* next_job = job->Next;
+        if (job->Failed && job->Mode[0] == 'a')
+        {
+            g.SettingsBinaryFileSize = 0;
+            ImGui::MarkIniSettingsDirty();
+        }
+        IM_FREE(job);
+        writer->JobsInFlight--;
+        job = next_job;
+    }
+}
+
+static void SettingsWriterShutdown(ImGuiContext* ctx)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiSettingsWriter* writer = g.SettingsWriter;
+    if (writer == NULL)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(writer->Mutex);
+        writer->Quit = true;
+    }
+    writer->Cond.notify_one();
+    writer->Thread.join();  // Thread exits after writing all pending jobs
+    for (ImGuiSettingsWriteJob* job = writer->Done; job != NULL; )
+    {
+        ImGuiSettingsWriteJob* next_job = job->Next;
+        IM_FREE(job);
+        job = next_job;
+    }
+    IM_DELETE(writer);
+    g.SettingsWriter = NULL;
+}
+
+#else
+
+static bool SettingsWriterEnqueue(ImGuiContext*, const char*, const char*, size_t, const char*, ImU64) { return false; }
+static void SettingsWriterCollect(ImGuiContext*) {}
+static void SettingsWriterShutdown(ImGuiContext*) {}
+
+#endif // #ifdef IMGUI_ENABLE_SETTINGS_THREAD
+
+// Return false if a synchronous write failed. Failures of background writes are handled by SettingsWriterCollect().
+static bool SettingsWriteOrEnqueue(ImGuiContext* ctx, const char* filename, const char* data, size_t data_size, const char* mode, ImU64 expected_file_size)
+{
+    // Once started, keep using the thread so files are always written in order
+    ImGuiContext& g = *ctx;
+    if (g.IO.IniSaveInBackground || g.SettingsWriter != NULL)
+        if (SettingsWriterEnqueue(&g, filename, data, data_size, mode, expected_file_size))
+            return true;
+    return SettingsWriteFile(filename, data, data_size, mode, expected_file_size);
+}
+
 static void* WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
 {
     ImGuiWindowSettings* settings = ImGui::FindWindowSettings(ImHashStr(name));
@@ -9736,10 +11378,10 @@ static void WindowSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*,
 {
     ImGuiWindowSettings* settings = (ImGuiWindowSettings*)entry;
     int x, y;
-    int i;
-    if (sscanf(line, "Pos=%i,%i", &x, &y) == 2)         settings->Pos = ImVec2ih((short)x, (short)y);
-    else if (sscanf(line, "Size=%i,%i", &x, &y) == 2)   settings->Size = ImVec2ih((short)x, (short)y);
-    else if (sscanf(line, "Collapsed=%d", &i) == 1)     settings->Collapsed = (i != 0);
+    const char* p;
+    if (strncmp(line, "Pos=", 4) == 0)              { if ((p = ImStrParseInt(line + 4, &x)) && *p == ',' && ImStrParseInt(p + 1, &y)) settings->Pos = ImVec2ih((short)x, (short)y); }
+    else if (strncmp(line, "Size=", 5) == 0)        { if ((p = ImStrParseInt(line + 5, &x)) && *p == ',' && ImStrParseInt(p + 1, &y)) settings->Size = ImVec2ih((short)x, (short)y); }
+    else if (strncmp(line, "Collapsed=", 10) == 0)  { if (ImStrParseInt(line + 10, &x)) settings->Collapsed = (x != 0); }
 }
 
 static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
@@ -9770,11 +11412,7 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
     for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
     {
         const char* settings_name = settings->GetName();
-        buf->appendf("[%s][%s]\n", handler->TypeName, settings_name);
-        buf->appendf("Pos=%d,%d\n", settings->Pos.x, settings->Pos.y);
-        buf->appendf("Size=%d,%d\n", settings->Size.x, settings->Size.y);
-        buf->appendf("Collapsed=%d\n", settings->Collapsed);
-        buf->append("\n");
+        buf->appendf("[%s][%s]\nPos=%d,%d\nSize=%d,%d\nCollapsed=%d\n\n", handler->TypeName, settings_name, settings->Pos.x, settings->Pos.y, settings->Size.x, settings->Size.y, settings->Collapsed);
     }
 }
 
@@ -9793,6 +11431,164 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
 // (this section is filled in the 'docking' branch)
 
 
+//-----------------------------------------------------------------------------
+// [SECTION] PROFILER
+//-----------------------------------------------------------------------------
+// Zones are written to a ring buffer without locks: a writer reserves a slot with an atomic increment of WriteCount,
+// fills it, then publishes it by storing its Sequence number. A reader only accepts a slot whose Sequence matches before
+// and after copying it (the slot may be overwritten by a writer which wrapped around the ring in the meantime).
+// This is a seqlock: the fences keep the zone fields from being reordered with the two Sequence accesses surrounding them.
+//-----------------------------------------------------------------------------
+
+#ifdef IMGUI_ENABLE_PROFILER
+
+#if !defined(_WIN32) || defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+#include <time.h>           // clock_gettime, timespec_get
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>         // _InterlockedXXX
+static inline ImU32 ProfilerAtomicIncrement(volatile ImU32* p)      { return (ImU32)_InterlockedIncrement((volatile long*)p); }
+static inline ImU32 ProfilerAtomicLoad(volatile ImU32* p)           { return (ImU32)_InterlockedCompareExchange((volatile long*)p, 0, 0); }
+static inline void  ProfilerAtomicStore(volatile ImU32* p, ImU32 v) { _InterlockedExchange((volatile long*)p, (long)v); }
+static inline void  ProfilerAtomicFenceAcquire()                    { volatile long fence = 0; _InterlockedOr(&fence, 0); } // Interlocked functions are full barriers
+static inline void  ProfilerAtomicFenceRelease()                    { volatile long fence = 0; _InterlockedOr(&fence, 0); }
+#else
+static inline ImU32 ProfilerAtomicIncrement(volatile ImU32* p)      { return __atomic_add_fetch(p, 1, __ATOMIC_RELAXED); }
+static inline ImU32 ProfilerAtomicLoad(volatile ImU32* p)           { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+static inline void  ProfilerAtomicStore(volatile ImU32* p, ImU32 v) { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+static inline void  ProfilerAtomicFenceAcquire()                    { __atomic_thread_fence(__ATOMIC_ACQUIRE); }
+static inline void  ProfilerAtomicFenceRelease()                    { __atomic_thread_fence(__ATOMIC_RELEASE); }
+#endif
+
+IM_STATIC_ASSERT((IMGUI_PROFILER_CAPACITY & (IMGUI_PROFILER_CAPACITY - 1)) == 0);
+
+ImGuiProfiler                               GImGuiProfiler = { {}, 0, true };
+static volatile ImU32                       GProfilerThreadCount = 0;
+static IM_THREAD_LOCAL ImU32                GProfilerThreadId = 0;
+
+ImU64 ImGui::ProfilerGetTime()
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+    static LARGE_INTEGER frequency = {};
+    if (frequency.QuadPart == 0)
+        ::QueryPerformanceFrequency(&frequency);
+    LARGE_INTEGER counter;
+    ::QueryPerformanceCounter(&counter);
+    return (ImU64)(counter.QuadPart / frequency.QuadPart) * 1000000000 + (ImU64)(counter.QuadPart % frequency.QuadPart) * 1000000000 / (ImU64)frequency.QuadPart;
+#elif defined(_WIN32)
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (ImU64)ts.tv_sec * 1000000000 + (ImU64)ts.tv_nsec;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ImU64)ts.tv_sec * 1000000000 + (ImU64)ts.tv_nsec;
+#endif
+}
+
+void ImGui::ProfilerRecordZone(const char* name, ImU64 start_time, ImU64 end_time)
+{
+    ImGuiProfiler& p = GImGuiProfiler;
+    ImGuiContext* ctx = GImGui;
+    if (GProfilerThreadId == 0)
+        GProfilerThreadId = ProfilerAtomicIncrement(&GProfilerThreadCount);
+    const ImU32 sequence = ProfilerAtomicIncrement(&p.WriteCount);
+    ImGuiProfilerZone* zone = &p.Zones[(sequence - 1) & (IMGUI_PROFILER_CAPACITY - 1)];
+    ProfilerAtomicStore(&zone->Sequence, 0);
+    ProfilerAtomicFenceRelease();   // Readers must see Sequence == 0 before any of the fields below change
+    zone->Name = name;
+    zone->StartTime = start_time;
+    zone->EndTime = end_time;
+    zone->Context = ctx;
+    zone->Frame = ctx ? ctx->FrameCount : -1;
+    zone->ThreadId = GProfilerThreadId;
+    ProfilerAtomicStore(&zone->Sequence, sequence);
+}
+
+int ImGui::ProfilerCopyZones(ImVector<ImGuiProfilerZone>* out_zones, int min_frame, ImGuiContext* ctx)
+{
+    ImGuiProfiler& p = GImGuiProfiler;
+    const ImU32 write_count = ProfilerAtomicLoad(&p.WriteCount);
+
+    // Walk backward from the most recent zone so we can stop at 'min_frame'.
+    // Frame numbers are only ordered within a context: without 'ctx' we need to walk the whole ring.
+    const int out_start = out_zones->Size;
+    ImU32 count = ImMin(write_count, (ImU32)IMGUI_PROFILER_CAPACITY);
+    for (ImU32 sequence = write_count; count > 0; sequence--, count--)
+    {
+        ImGuiProfilerZone* src = &p.Zones[(sequence - 1) & (IMGUI_PROFILER_CAPACITY - 1)];
+        if (ProfilerAtomicLoad(&src->Sequence) != sequence)
+            continue;
+        ImGuiProfilerZone zone;
+        zone.Name = src->Name;
+        zone.StartTime = src->StartTime;
+        zone.EndTime = src->EndTime;
+        zone.Context = src->Context;
+        zone.Frame = src->Frame;
+        zone.ThreadId = src->ThreadId;
+        zone.Sequence = sequence;
+        ProfilerAtomicFenceAcquire();   // Read the fields above before checking Sequence again
+        if (ProfilerAtomicLoad(&src->Sequence) != sequence)
+            continue;
+        if (ctx != NULL && zone.Context != ctx)
+            continue;
+        if (zone.Frame < min_frame)
+        {
+            if (ctx != NULL)
+                break;
+            continue;
+        }
+        out_zones->push_back(zone);
+    }
+
+    // Restore recording order
+    for (int i = out_start, j = out_zones->Size - 1; i < j; i++, j--)
+        ImSwap((*out_zones)[i], (*out_zones)[j]);
+    return out_zones->Size - out_start;
+}
+
+// Write zones in the Trace Event Format, as "complete" events with microseconds timestamps.
+// Each context is reported as a process (pid 1, 2.. in order of appearance, 0 for zones recorded without a context).
+// Load with chrome://tracing or https://ui.perfetto.dev
+bool ImGui::ProfilerWriteChromeTrace(const char* filename)
+{
+    ImVector<ImGuiProfilerZone> zones;
+    ProfilerCopyZones(&zones);
+    ImVector<ImGuiContext*> contexts;
+
+    ImGuiTextBuffer buf;
+    buf.reserve(zones.Size * 128 + 64);
+    buf.append("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    ImU64 base_time = (ImU64)-1;
+    for (int n = 0; n < zones.Size; n++)
+        base_time = ImMin(base_time, zones[n].StartTime);
+    for (int n = 0; n < zones.Size; n++)
+    {
+        const ImGuiProfilerZone& zone = zones[n];
+        int pid = 0;
+        if (zone.Context != NULL)
+        {
+            pid = (int)(contexts.find(zone.Context) - contexts.Data) + 1;
+            if (pid == contexts.Size + 1)
+                contexts.push_back(zone.Context);
+        }
+        buf.appendf("%s\n{\"name\":\"%s\",\"cat\":\"imgui\",\"ph\":\"X\",\"pid\":%d,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%d}}",
+            n > 0 ? "," : "", zone.Name, pid, zone.ThreadId, (double)(zone.StartTime - base_time) / 1000.0, (double)(zone.EndTime - zone.StartTime) / 1000.0, zone.Frame);
+    }
+    buf.append("\n]}\n");
+
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    const bool ret = ImFileWrite(buf.c_str(), sizeof(char), (ImU64)buf.size(), f) == (ImU64)buf.size();
+    ImFileClose(f);
+    return ret;
+}
+
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
+
 //-----------------------------------------------------------------------------
 // [SECTION] PLATFORM DEPENDENT HELPERS
 //-----------------------------------------------------------------------------
@@ -9972,6 +11768,62 @@ static void MetricsHelpMarker(const char* desc)
     }
 }
 
+// Capacity in bytes of the buffers of a draw list
+static size_t MetricsGetDrawListMemory(const ImDrawList* draw_list)
+{
+    size_t size = (size_t)draw_list->CmdBuffer.capacity() * sizeof(ImDrawCmd) + (size_t)draw_list->IdxBuffer.capacity() * sizeof(ImDrawIdx) + (size_t)draw_list->VtxBuffer.capacity() * sizeof(ImDrawVert);
+    size += (size_t)draw_list->IdxSpans.capacity() * sizeof(ImDrawIdxSpan) + (size_t)(draw_list->VtxDirtyRanges.capacity() + draw_list->IdxDirtyRanges.capacity()) * sizeof(ImDrawDirtyRange);
+    size += (size_t)(draw_list->_VtxPrevious.capacity() + draw_list->_IdxPrevious.capacity());
+    size += (size_t)draw_list->_ClipRectStack.capacity() * sizeof(ImVec4) + (size_t)draw_list->_TextureIdStack.capacity() * sizeof(ImTextureID) + (size_t)draw_list->_Path.capacity() * sizeof(ImVec2);
+    for (int n = 0; n < draw_list->_IdxSpanStorage.Size; n++)
+        size += (size_t)draw_list->_IdxSpanStorage[n].capacity() * sizeof(ImDrawIdx);
+    size += (size_t)draw_list->_IdxSpanStorage.capacity() * sizeof(ImVector<ImDrawIdx>);
+    for (int n = 0; n < draw_list->_Splitter._Channels.Size; n++)
+        size += (size_t)draw_list->_Splitter._Channels[n]._CmdBuffer.capacity() * sizeof(ImDrawCmd) + (size_t)draw_list->_Splitter._Channels[n]._IdxBuffer.capacity() * sizeof(ImDrawIdx);
+    size += (size_t)draw_list->_Splitter._Channels.capacity() * sizeof(ImDrawChannel);
+    return size;
+}
+
+// Capacity in bytes of the buffers released by GcCompactTransientWindowBuffers(), apart from the draw list
+static size_t MetricsGetWindowTransientMemory(const ImGuiWindow* window)
+{
+    return (size_t)window->IDStack.capacity() * sizeof(ImGuiID) + (size_t)window->DC.ChildWindows.capacity() * sizeof(ImGuiWindow*) + (size_t)window->DC.ItemFlagsStack.capacity() * sizeof(ImGuiItemFlags)
+        + (size_t)(window->DC.ItemWidthStack.capacity() + window->DC.TextWrapPosStack.capacity()) * sizeof(float) + (size_t)window->DC.GroupStack.capacity() * sizeof(ImGuiGroupData);
+}
+
+struct ImGuiMetricsWindowMemory
+{
+    ImGuiWindow*    Window;
+    size_t          DrawListBytes;
+    size_t          TransientBytes;
+};
+
+static int IMGUI_CDECL MetricsWindowMemoryComparerBySize(const void* lhs, const void* rhs)
+{
+    const ImGuiMetricsWindowMemory* a = (const ImGuiMetricsWindowMemory*)lhs;
+    const ImGuiMetricsWindowMemory* b = (const ImGuiMetricsWindowMemory*)rhs;
+    const size_t a_size = a->DrawListBytes + a->TransientBytes;
+    const size_t b_size = b->DrawListBytes + b->TransientBytes;
+    return (a_size < b_size) ? +1 : (a_size > b_size) ? -1 : 0;
+}
+
+#ifdef IMGUI_ENABLE_PROFILER
+struct ImGuiMetricsProfilerZoneStats
+{
+    const char*     Name;
+    int             Count;
+    ImU64           TotalTime;
+    ImU64           MaxTime;
+};
+
+static int IMGUI_CDECL MetricsProfilerZoneStatsComparerByTotalTime(const void* lhs, const void* rhs)
+{
+    const ImU64 a = ((const ImGuiMetricsProfilerZoneStats*)lhs)->TotalTime;
+    const ImU64 b = ((const ImGuiMetricsProfilerZoneStats*)rhs)->TotalTime;
+    return (a < b) ? +1 : (a > b) ? -1 : 0;
+}
+#endif
+
 void ImGui::ShowMetricsWindow(bool* p_open)
 {
     if (!ImGui::Begin("Dear ImGui Metrics", p_open))
@@ -10001,6 +11853,8 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     ImGui::Text("Dear ImGui %s", ImGui::GetVersion());
     ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     ImGui::Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
+    if (io.ConfigDrawListDiff && io.MetricsRenderDirtyBytes >= 0)
+        ImGui::Text("%d bytes modified since previous frame", io.MetricsRenderDirtyBytes);
     ImGui::Text("%d active windows (%d visible)", io.MetricsActiveWindows, io.MetricsRenderWindows);
     ImGui::Text("%d active allocations", io.MetricsActiveAllocations);
     ImGui::Separator();
@@ -10031,7 +11885,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         {
             IM_ASSERT(show_mesh || show_aabb);
             ImDrawList* fg_draw_list = GetForegroundDrawList(window); // Render additional visuals into the top-most draw list
-            ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL;
+            const bool has_idx_buffer = draw_list->GetIdxCount() > 0;
 
             // Draw wire-frame version of all triangles
             ImRect clip_rect = draw_cmd->ClipRect;
@@ -10043,7 +11897,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
                 ImVec2 triangle[3];
                 for (int n = 0; n < 3; n++)
                 {
-                    ImVec2 p = draw_list->VtxBuffer[idx_buffer ? idx_buffer[base_idx + n] : (base_idx + n)].pos;
+                    ImVec2 p = draw_list->VtxBuffer[has_idx_buffer ? draw_list->GetIdx(base_idx + n) : (base_idx + n)].pos;
                     triangle[n] = p;
                     vtxs_rect.Add(p);
                 }
@@ -10061,7 +11915,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
 
         static void NodeDrawList(ImGuiWindow* window, ImDrawList* draw_list, const char* label)
         {
-            bool node_open = ImGui::TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, draw_list->CmdBuffer.Size);
+            bool node_open = ImGui::TreeNode(draw_list, "%s: '%s' %d vtx, %d indices (%d-bit), %d cmds, %d culled", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->GetIdxCount(), (int)draw_list->IdxSize * 8, draw_list->CmdBuffer.Size, draw_list->_CulledPrimCount);
             if (draw_list == ImGui::GetWindowDrawList())
             {
                 ImGui::SameLine();
@@ -10090,7 +11944,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
                     continue;
                 }
 
-                ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL;
+                const bool has_idx_buffer = draw_list->GetIdxCount() > 0;
                 char buf[300];
                 ImFormatString(buf, IM_ARRAYSIZE(buf), "DrawCmd: %4d triangles, Tex 0x%p, ClipRect (%4.0f,%4.0f)-(%4.0f,%4.0f)",
                     pcmd->ElemCount/3, (void*)(intptr_t)pcmd->TextureId,
@@ -10108,7 +11962,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
                 {
                     ImVec2 triangle[3];
                     for (int n = 0; n < 3; n++)
-                        triangle[n] = draw_list->VtxBuffer[idx_buffer ? idx_buffer[base_idx + n] : (base_idx + n)].pos;
+                        triangle[n] = draw_list->VtxBuffer[has_idx_buffer ? draw_list->GetIdx(base_idx + n) : (base_idx + n)].pos;
                     total_area += ImTriangleArea(triangle[0], triangle[1], triangle[2]);
                 }
 
@@ -10127,10 +11981,11 @@ void ImGui::ShowMetricsWindow(bool* p_open)
                         ImVec2 triangle[3];
                         for (int n = 0; n < 3; n++, idx_i++)
                         {
-                            ImDrawVert& v = draw_list->VtxBuffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
-                            triangle[n] = v.pos;
+                            ImDrawVert& v = draw_list->VtxBuffer[has_idx_buffer ? draw_list->GetIdx(idx_i) : idx_i];
+                            ImVec2 v_pos = v.pos, v_uv = v.uv;
+                            triangle[n] = v_pos;
                             buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                                (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                                (n == 0) ? "Vert:" : "     ", idx_i, v_pos.x, v_pos.y, v_uv.x, v_uv.y, v.col);
                         }
 
                         ImGui::Selectable(buf, false);
@@ -10190,6 +12045,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
 
             ImGuiWindowFlags flags = window->Flags;
             NodeDrawList(window, window->DrawList, "DrawList");
+            ImGui::BulletText("Memory: DrawList %d bytes, IDStack and layout stacks %d bytes", (int)MetricsGetDrawListMemory(window->DrawList), (int)MetricsGetWindowTransientMemory(window));
             ImGui::BulletText("Pos: (%.1f,%.1f), Size: (%.1f,%.1f), ContentSize (%.1f,%.1f)", window->Pos.x, window->Pos.y, window->Size.x, window->Size.y, window->ContentSize.x, window->ContentSize.y);
             ImGui::BulletText("Flags: 0x%08X (%s%s%s%s%s%s%s%s%s..)", flags,
                 (flags & ImGuiWindowFlags_ChildWindow)  ? "Child " : "",      (flags & ImGuiWindowFlags_Tooltip)     ? "Tooltip "   : "",  (flags & ImGuiWindowFlags_Popup) ? "Popup " : "",
@@ -10241,7 +12097,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
 
         static void NodeStorage(ImGuiStorage* storage, const char* label)
         {
-            if (!ImGui::TreeNode(label, "%s: %d entries, %d bytes", label, storage->Data.Size, storage->Data.size_in_bytes()))
+            if (!ImGui::TreeNode(label, "%s: %d entries, %d bytes%s", label, storage->Data.Size, storage->Data.size_in_bytes() + storage->HashIndex.size_in_bytes(), storage->HashIndex.Size > 0 ? " (hashed)" : ""))
                 return;
             for (int n = 0; n < storage->Data.Size; n++)
             {
@@ -10333,6 +12189,149 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     }
 #endif // #define IMGUI_HAS_DOCK
 
+    // Details for Memory
+    if (ImGui::TreeNode("Memory"))
+    {
+#ifdef IMGUI_ENABLE_MEMORY_ACCOUNTING
+        const char* mem_tag_names[] = { "Misc", "Windows", "DrawLists", "FontAtlas", "Storage", "Settings", "TextEdit", "FrameArena" };
+        IM_STATIC_ASSERT(IM_ARRAYSIZE(mem_tag_names) == ImGuiMemTag_COUNT);
+        ImGui::Columns(6, "##memory_tags");
+        ImGui::Text("Subsystem"); ImGui::NextColumn();
+        ImGui::Text("Allocs"); ImGui::NextColumn();
+        ImGui::Text("KB"); ImGui::NextColumn();
+        ImGui::Text("Max KB"); ImGui::NextColumn();
+        ImGui::Text("Allocs/frame"); ImGui::SameLine(); MetricsHelpMarker("Allocations made while this context was current, during its previous frame.\nThe other columns are for all contexts.");
+        ImGui::NextColumn();
+        ImGui::Text("Total allocs"); ImGui::NextColumn();
+        ImGui::Separator();
+        for (int tag = 0; tag < ImGuiMemTag_COUNT; tag++)
+        {
+            ImGuiMemTagStats& stats = GImMemTagStats[tag];
+            ImGui::TextUnformatted(mem_tag_names[tag]); ImGui::NextColumn();
+            ImGui::Text("%d", MemTagStatsLoad(&stats.ActiveAllocCount)); ImGui::NextColumn();
+            ImGui::Text("%.1f", MemTagStatsLoad(&stats.ActiveBytes) / 1024.0f); ImGui::NextColumn();
+            ImGui::Text("%.1f", MemTagStatsLoad(&stats.ActiveBytesMax) / 1024.0f); ImGui::NextColumn();
+            ImGui::Text("%d", g.MemTagAllocCountPrevFrame[tag]); ImGui::NextColumn();
+            ImGui::Text("%d", MemTagStatsLoad(&stats.AllocCount)); ImGui::NextColumn();
+        }
+        ImGui::Columns(1);
+#else
+        ImGui::TextDisabled("Define IMGUI_ENABLE_MEMORY_ACCOUNTING in imconfig.h to track allocations per subsystem.");
+#endif
+
+        // Buffers of each window, largest first. Compacting windows allows checking what GcCompactTransientWindowBuffers() reclaims.
+        const int windows_count = g.Windows.Size;
+        ImGuiMetricsWindowMemory* windows_memory = (ImGuiMetricsWindowMemory*)IM_ALLOC_FRAME(windows_count * sizeof(ImGuiMetricsWindowMemory));
+        size_t windows_memory_total = 0;
+        for (int n = 0; n < windows_count; n++)
+        {
+            ImGuiWindow* window = g.Windows[n];
+            ImGuiMetricsWindowMemory window_memory = { window, MetricsGetDrawListMemory(window->DrawList), MetricsGetWindowTransientMemory(window) };
+            windows_memory[n] = window_memory;
+            windows_memory_total += window_memory.DrawListBytes + window_memory.TransientBytes;
+        }
+        if (windows_count > 1)
+            ImQsort(windows_memory, (size_t)windows_count, sizeof(ImGuiMetricsWindowMemory), MetricsWindowMemoryComparerBySize);
+        if (ImGui::Button("Compact hidden windows"))
+            for (int n = 0; n < g.Windows.Size; n++)
+                if (!g.Windows[n]->WasActive && !g.Windows[n]->MemoryCompacted)
+                    GcCompactTransientWindowBuffers(g.Windows[n]);
+        ImGui::SameLine();
+        MetricsHelpMarker("Hidden windows are compacted automatically after io.ConfigWindowsMemoryCompactTimer seconds.");
+        if (ImGui::TreeNode("WindowsMemory", "Windows buffers (%d KB)", (int)(windows_memory_total / 1024)))
+        {
+            for (int n = 0; n < windows_count; n++)
+            {
+                const ImGuiMetricsWindowMemory& window_memory = windows_memory[n];
+                ImGui::BulletText("'%s': %d KB (DrawList %d bytes, stacks %d bytes)%s", window_memory.Window->Name, (int)((window_memory.DrawListBytes + window_memory.TransientBytes) / 1024),
+                    (int)window_memory.DrawListBytes, (int)window_memory.TransientBytes, window_memory.Window->MemoryCompacted ? " (compacted)" : "");
+                if (ImGui::IsItemHovered() && window_memory.Window->WasActive)
+                    ImGui::GetForegroundDrawList()->AddRect(window_memory.Window->Pos, window_memory.Window->Pos + window_memory.Window->Size, IM_COL32(255, 255, 0, 255));
+            }
+            ImGui::TreePop();
+        }
+        ImGui::TreePop();
+    }
+
+    // Details for Frame Arena
+    if (ImGui::TreeNode("FrameArena", "Frame Arena (%d KB)", (int)(g.FrameArena.UsedBytesPrevFrame / 1024)))
+    {
+        const ImGuiFrameArena& arena = g.FrameArena;
+        size_t capacity = 0;
+        for (int n = 0; n < arena.Blocks.Size; n++)
+            capacity += arena.Blocks[n].Size;
+        ImGui::Text("Previous frame: %d bytes, high-water: %d bytes", (int)arena.UsedBytesPrevFrame, (int)arena.UsedBytesMax);
+        ImGui::Text("Capacity: %d bytes in %d blocks", (int)capacity, arena.Blocks.Size);
+        for (int n = 0; n < arena.Callsites.Size; n++)
+        {
+            const ImGuiFrameArenaCallsite& callsite = arena.Callsites[n];
+            ImGui::BulletText("%s(%d): %d allocs, %d bytes in previous frame, max %d bytes", callsite.File ? callsite.File : "(unknown)", callsite.Line, callsite.AllocCountPrevFrame, (int)callsite.AllocBytesPrevFrame, (int)callsite.AllocBytesMax);
+        }
+        ImGui::TreePop();
+    }
+
+    // Details for Profiler
+#ifdef IMGUI_ENABLE_PROFILER
+    if (ImGui::TreeNode("Profiler"))
+    {
+        ImGuiProfiler& p = GImGuiProfiler;
+        ImGui::Checkbox("Enabled", &p.Enabled);
+        ImGui::SameLine();
+        if (ImGui::Button("Write imgui_trace.json"))
+            ImGui::ProfilerWriteChromeTrace("imgui_trace.json");
+        ImGui::SameLine();
+        MetricsHelpMarker("Write the zones in the ring buffer in the Trace Event Format.\nOpen with chrome://tracing or https://ui.perfetto.dev");
+
+        // Aggregate zones of the last complete frame of this context. Times are inclusive of nested zones (e.g. Begin() includes ItemAdd()).
+        const int frame = g.FrameCount - 1;
+        ImVector<ImGuiProfilerZone> zones;
+        ImGui::ProfilerCopyZones(&zones, frame, &g);
+        ImVector<ImGuiMetricsProfilerZoneStats> stats;
+        for (int zone_n = 0; zone_n < zones.Size; zone_n++)
+        {
+            const ImGuiProfilerZone& zone = zones[zone_n];
+            if (zone.Frame != frame)
+                continue;
+            ImGuiMetricsProfilerZoneStats* zone_stats = NULL;
+            for (int stats_n = 0; stats_n < stats.Size && zone_stats == NULL; stats_n++)
+                if (stats[stats_n].Name == zone.Name)
+                    zone_stats = &stats[stats_n];
+            if (zone_stats == NULL)
+            {
+                ImGuiMetricsProfilerZoneStats new_stats = { zone.Name, 0, 0, 0 };
+                stats.push_back(new_stats);
+                zone_stats = &stats.back();
+            }
+            const ImU64 duration = zone.EndTime - zone.StartTime;
+            zone_stats->Count++;
+            zone_stats->TotalTime += duration;
+            zone_stats->MaxTime = ImMax(zone_stats->MaxTime, duration);
+        }
+        if (stats.Size > 1)
+            ImQsort(stats.Data, (size_t)stats.Size, sizeof(ImGuiMetricsProfilerZoneStats), MetricsProfilerZoneStatsComparerByTotalTime);
+
+        ImGui::Text("Frame %d, %u zones recorded (capacity %d)", frame, p.WriteCount, IMGUI_PROFILER_CAPACITY);
+        ImGui::Columns(5, "##profiler_zones");
+        ImGui::Text("Zone"); ImGui::NextColumn();
+        ImGui::Text("Calls"); ImGui::NextColumn();
+        ImGui::Text("Total (ms)"); ImGui::NextColumn();
+        ImGui::Text("Avg (us)"); ImGui::NextColumn();
+        ImGui::Text("Max (us)"); ImGui::NextColumn();
+        ImGui::Separator();
+        for (int stats_n = 0; stats_n < stats.Size; stats_n++)
+        {
+            const ImGuiMetricsProfilerZoneStats& zone_stats = stats[stats_n];
+            ImGui::TextUnformatted(zone_stats.Name); ImGui::NextColumn();
+            ImGui::Text("%d", zone_stats.Count); ImGui::NextColumn();
+            ImGui::Text("%.3f", zone_stats.TotalTime / 1000000.0); ImGui::NextColumn();
+            ImGui::Text("%.2f", zone_stats.TotalTime / 1000.0 / zone_stats.Count); ImGui::NextColumn();
+            ImGui::Text("%.2f", zone_stats.MaxTime / 1000.0); ImGui::NextColumn();
+        }
+        ImGui::Columns(1);
+        ImGui::TreePop();
+    }
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
     // Misc Details
     if (ImGui::TreeNode("Internal state"))
     {
@@ -29,7 +29,7 @@ Index of this file:
 // ImGuiIO
 // Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
 // Obsolete functions
-// Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
+// Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiListClipperHeights, ImColor)
 // Draw List API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData)
 // Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
 
@@ -117,7 +117,7 @@ struct ImDrawData;                  // All draw command lists required to render
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 bytes with IMGUI_USE_COMPACT_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
@@ -128,6 +128,7 @@ struct ImGuiContext;                // Dear ImGui context (opaque structure, unl
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiListClipperHeights;     // Helper to store the measured heights of a list of items of variable height, for ImGuiListClipper
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame, used by IMGUI_ONCE_UPON_A_FRAME macro
 struct ImGuiPayload;                // User data payload for drag and drop operations
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
@@ -135,6 +136,7 @@ struct ImGuiStorage;                // Helper for key->value storage
 struct ImGuiStyle;                  // Runtime data for styling/colors
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
+struct ImGuiWindow;                 // Window (opaque structure, unless including imgui_internal.h), see ImGuiWindowHandle
 
 // Enums/Flags (declared as int for compatibility with old C++, to allow using as flags and to not pollute the top of this file)
 // - Tip: Use your programming IDE navigation facilities on the names in the _central column_ below to find the actual flags/enum lists!
@@ -161,6 +163,7 @@ typedef int ImGuiFocusedFlags;      // -> enum ImGuiFocusedFlags_    // Flags: f
 typedef int ImGuiHoveredFlags;      // -> enum ImGuiHoveredFlags_    // Flags: for IsItemHovered(), IsWindowHovered() etc.
 typedef int ImGuiInputTextFlags;    // -> enum ImGuiInputTextFlags_  // Flags: for InputText(), InputTextMultiline()
 typedef int ImGuiKeyModFlags;       // -> enum ImGuiKeyModFlags_     // Flags: for io.KeyMods (Ctrl/Shift/Alt/Super)
+typedef int ImGuiPlotFlags;         // -> enum ImGuiPlotFlags_       // Flags: for PlotLines(), PlotHistogram()
 typedef int ImGuiSelectableFlags;   // -> enum ImGuiSelectableFlags_ // Flags: for Selectable()
 typedef int ImGuiTabBarFlags;       // -> enum ImGuiTabBarFlags_     // Flags: for BeginTabBar()
 typedef int ImGuiTabItemFlags;      // -> enum ImGuiTabItemFlags_    // Flags: for BeginTabItem()
@@ -172,6 +175,7 @@ typedef int ImGuiWindowFlags;       // -> enum ImGuiWindowFlags_     // Flags: f
 typedef void* ImTextureID;          // User data for rendering back-end to identify a texture. This is whatever to you want it to be! read the FAQ about ImTextureID for details.
 #endif
 typedef unsigned int ImGuiID;       // A unique ID used by widgets, typically hashed from a stack of string.
+typedef ImGuiWindow* ImGuiWindowHandle; // Interned window, initialize to NULL and pass to Begin()/BeginChild() to skip looking up the window by name.
 typedef int (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData *data);
 typedef void (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);
 
@@ -250,6 +254,8 @@ namespace ImGui
     IMGUI_API void          EndFrame();                                 // ends the Dear ImGui frame. automatically called by Render(). If you don't need to render data (skipping rendering) you may call EndFrame() without Render()... but you'll have wasted CPU already! If you don't need to render, better to not create any windows and not call NewFrame() at all!
     IMGUI_API void          Render();                                   // ends the Dear ImGui frame, finalize the draw data. You can get call GetDrawData() to obtain it and run your rendering function (up to v1.60, this used to call io.RenderDrawListsFn(). Nowadays, we allow and prefer calling your render function yourself.)
     IMGUI_API ImDrawData*   GetDrawData();                              // valid after Render() and until the next call to NewFrame(). this is what you have to render.
+    IMGUI_API bool          IsFrameIdle();                              // call after Render() and before the next NewFrame(): true if the last frame's output is the same as the previous one and no input, animation, timer, navigation or drag and drop is in progress. The application may then wait for input events before starting a new frame.
+    IMGUI_API float         GetIdleWaitTime();                          // call after Render() and before the next NewFrame(): 0.0f if not idle, otherwise the time in seconds after which a new frame is needed even without input events (e.g. text cursor blink, .ini saving), or FLT_MAX.
 
     // Demo, Debug, Information
     IMGUI_API void          ShowDemoWindow(bool* p_open = NULL);        // create Demo window (previously called ShowTestWindow). demonstrate most ImGui features. call this to learn about the library! try to make it always available in your application!
@@ -277,7 +283,10 @@ namespace ImGui
     //    BeginPopup/EndPopup, etc. where the EndXXX call should only be called if the corresponding BeginXXX function
     //    returned true. Begin and BeginChild are the only odd ones out. Will be fixed in a future update.]
     // - Note that the bottom of window stack always contains a window called "Debug".
+    // - Begin() hashes 'name' and looks up the window every frame. The ImGuiWindowHandle version only does it on its first call, then stores
+    //   the window in the handle for later frames. Handles stay valid for the lifetime of the context (windows are never destroyed).
     IMGUI_API bool          Begin(const char* name, bool* p_open = NULL, ImGuiWindowFlags flags = 0);
+    IMGUI_API bool          Begin(ImGuiWindowHandle* handle, const char* name, bool* p_open = NULL, ImGuiWindowFlags flags = 0);
     IMGUI_API void          End();
 
     // Child Windows
@@ -287,6 +296,7 @@ namespace ImGui
     //   Always call a matching EndChild() for each BeginChild() call, regardless of its return value [as with Begin: this is due to legacy reason and inconsistent with most BeginXXX functions apart from the regular Begin() which behaves like BeginChild().]
     IMGUI_API bool          BeginChild(const char* str_id, const ImVec2& size = ImVec2(0,0), bool border = false, ImGuiWindowFlags flags = 0);
     IMGUI_API bool          BeginChild(ImGuiID id, const ImVec2& size = ImVec2(0,0), bool border = false, ImGuiWindowFlags flags = 0);
+    IMGUI_API bool          BeginChild(ImGuiWindowHandle* handle, const char* str_id, const ImVec2& size = ImVec2(0,0), bool border = false, ImGuiWindowFlags flags = 0); // skip hashing and name formatting after the first call. the handle must always be used from the same parent window and ID stack.
     IMGUI_API void          EndChild();
 
     // Windows Utilities
@@ -410,6 +420,7 @@ namespace ImGui
     IMGUI_API void          PushID(const char* str_id_begin, const char* str_id_end);       // push string into the ID stack (will hash string).
     IMGUI_API void          PushID(const void* ptr_id);                                     // push pointer into the ID stack (will hash pointer).
     IMGUI_API void          PushID(int int_id);                                             // push integer into the ID stack (will hash integer).
+    IMGUI_API void          PushIDPrecomputed(ImGuiID id);                                  // push an ID returned by GetID(str_id) in the same ID stack context: same as PushID(str_id) without hashing the string.
     IMGUI_API void          PopID();                                                        // pop from the ID stack.
     IMGUI_API ImGuiID       GetID(const char* str_id);                                      // calculate unique ID (hash of whole ID stack + given parameter). e.g. if you want to query into ImGuiStorage yourself
     IMGUI_API ImGuiID       GetID(const char* str_id_begin, const char* str_id_end);
@@ -449,6 +460,7 @@ namespace ImGui
     // Widgets: Combo Box
     // - The BeginCombo()/EndCombo() api allows you to manage your contents and selection state however you want it, by creating e.g. Selectable() items.
     // - The old Combo() api are helpers over BeginCombo()/EndCombo() which are kept available for convenience purpose.
+    // - Combo() and ListBox() only submit visible items, and support type-ahead: typing the start of a label moves the focus to the first item with that label (case-insensitive).
     IMGUI_API bool          BeginCombo(const char* label, const char* preview_value, ImGuiComboFlags flags = 0);
     IMGUI_API void          EndCombo(); // only call EndCombo() if BeginCombo() returns true!
     IMGUI_API bool          Combo(const char* label, int* current_item, const char* const items[], int items_count, int popup_max_height_in_items = -1);
@@ -520,8 +532,21 @@ namespace ImGui
     IMGUI_API bool          ColorPicker3(const char* label, float col[3], ImGuiColorEditFlags flags = 0);
     IMGUI_API bool          ColorPicker4(const char* label, float col[4], ImGuiColorEditFlags flags = 0, const float* ref_col = NULL);
     IMGUI_API bool          ColorButton(const char* desc_id, const ImVec4& col, ImGuiColorEditFlags flags = 0, ImVec2 size = ImVec2(0,0));  // display a colored square/button, hover for details, return true when pressed.
+    IMGUI_API bool          ColorPalette(const char* str_id, int* current_index, const ImVec4* colors, int colors_count, ImGuiColorEditFlags flags = 0, ImVec2 swatch_size = ImVec2(0,0), int columns = 0); // display a grid of colored squares (cheaper than many ColorButton), return true when a swatch is clicked and *current_index was set. columns = 0: fit to available width. The grid is a single item for navigation.
     IMGUI_API void          SetColorEditOptions(ImGuiColorEditFlags flags);                     // initialize current options (generally on application startup) if you want to select a default format, picker type, etc. User will be able to change many settings, unless you pass the _NoOptions flag to your calls.
 
+    // Widgets: Color History
+    // - ColorPicker4() shows the recent colors under its side preview, and adds to them the colors the user finished editing.
+    // - The palette is a list of up to 1M colors saved in the .ini file. Display it with e.g. 'ColorPalette("##palette", &index, GetPaletteColors(&count), count)'.
+    // - Colors are compared with 8-bit per channel precision (duplicates are ignored), which is also the precision the palette is stored with. Colors are RGBA.
+    IMGUI_API void          AddRecentColor(const ImVec4& col);                                  // add to the recent colors, or move to the front if already present.
+    IMGUI_API const ImVec4* GetRecentColors(int* out_count);                                    // most recent first.
+    IMGUI_API bool          AddPaletteColor(const ImVec4& col);                                 // return false if the color is already in the palette or the palette is full.
+    IMGUI_API int           FindPaletteColor(const ImVec4& col);                                // return index in palette or -1.
+    IMGUI_API void          RemovePaletteColor(int index);
+    IMGUI_API void          ClearPaletteColors();
+    IMGUI_API const ImVec4* GetPaletteColors(int* out_count);
+
     // Widgets: Trees
     // - TreeNode functions return true when the node is open, in which case you need to also call TreePop() when you are finished displaying the tree node contents.
     IMGUI_API bool          TreeNode(const char* label);
@@ -557,10 +582,12 @@ namespace ImGui
     IMGUI_API void          ListBoxFooter();                                                    // terminate the scrolling region. only call ListBoxFooter() if ListBoxHeader() returned true!
 
     // Widgets: Data Plotting
-    IMGUI_API void          PlotLines(const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));
-    IMGUI_API void          PlotLines(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
-    IMGUI_API void          PlotHistogram(const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));
-    IMGUI_API void          PlotHistogram(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
+    // - When there are more values than pixels, each pixel column displays the min/max range of its values (so peaks are never missed).
+    // - Use ImGuiPlotFlags_CacheValues on large series which are only appended to, so a frame costs O(graph width) instead of O(values_count).
+    IMGUI_API void          PlotLines(const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float), ImGuiPlotFlags flags = 0);
+    IMGUI_API void          PlotLines(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), ImGuiPlotFlags flags = 0);
+    IMGUI_API void          PlotHistogram(const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float), ImGuiPlotFlags flags = 0);
+    IMGUI_API void          PlotHistogram(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), ImGuiPlotFlags flags = 0);
 
     // Widgets: Value() Helpers.
     // - Those are merely shortcut to calling Text() with a format string. Output single value in "name: value" format (tip: freely declare more in your code to handle your types. you can add functions to the ImGui namespace)
@@ -755,6 +782,7 @@ namespace ImGui
     IMGUI_API void          SetAllocatorFunctions(void* (*alloc_func)(size_t sz, void* user_data), void (*free_func)(void* ptr, void* user_data), void* user_data = NULL);
     IMGUI_API void*         MemAlloc(size_t size);
     IMGUI_API void          MemFree(void* ptr);
+    IMGUI_API void*         MemAllocFrame(size_t size, const char* file = NULL, int line = 0);  // Allocate from the current context's frame arena (see IM_ALLOC_FRAME). Never free this memory: all of it is released by the next NewFrame().
 
 } // namespace ImGui
 
@@ -826,6 +854,7 @@ enum ImGuiInputTextFlags_
     ImGuiInputTextFlags_NoUndoRedo          = 1 << 16,  // Disable undo/redo. Note that input text owns the text data while active, if you want to provide your own undo/redo stack you need e.g. to call ClearActiveID().
     ImGuiInputTextFlags_CharsScientific     = 1 << 17,  // Allow 0123456789.+-*/eE (Scientific notation input)
     ImGuiInputTextFlags_CallbackResize      = 1 << 18,  // Callback on buffer capacity changes request (beyond 'buf_size' parameter value), allowing the string to grow. Notify when the string wants to be resized (for string types which hold a cache of their Size). You will be provided a new BufSize in the callback and NEED to honor it. (see misc/cpp/imgui_stdlib.h for an example of using this)
+    ImGuiInputTextFlags_LargeDocument       = 1 << 19,  // InputTextMultiline() only: edit in a gap buffer with a line index, so only visible lines are measured and rendered. Automatically enabled for texts of 1 MB or more. Read-only text is captured when activated.
     // [Internal]
     ImGuiInputTextFlags_Multiline           = 1 << 20,  // For internal use by InputTextMultiline()
     ImGuiInputTextFlags_NoMarkEdited        = 1 << 21   // For internal use by functions using InputText() before reformatting data
@@ -878,6 +907,13 @@ enum ImGuiComboFlags_
     ImGuiComboFlags_HeightMask_             = ImGuiComboFlags_HeightSmall | ImGuiComboFlags_HeightRegular | ImGuiComboFlags_HeightLarge | ImGuiComboFlags_HeightLargest
 };
 
+// Flags for ImGui::PlotLines(), ImGui::PlotHistogram()
+enum ImGuiPlotFlags_
+{
+    ImGuiPlotFlags_None                     = 0,
+    ImGuiPlotFlags_CacheValues              = 1 << 0    // Values are never modified, only appended to (e.g. a log): keep a min/max pyramid over them, updated with new values only. The cache is rebuilt when values_count decreases or when the values pointer/getter/data change.
+};
+
 // Flags for ImGui::BeginTabBar()
 enum ImGuiTabBarFlags_
 {
@@ -1077,7 +1113,11 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasGamepad            = 1 << 0,   // Back-end Platform supports gamepad and currently has one connected.
     ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Back-end Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Back-end Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if ImGuiConfigFlags_NavEnableSetMousePos is set).
-    ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3    // Back-end Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Back-end Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasIdxSize    = 1 << 4,   // Back-end Renderer supports ImDrawList::IdxSize. With 16-bit ImDrawIdx, lists with 64K vertices or more are submitted with 32-bit indices. With 32-bit ImDrawIdx, lists with less than 64K vertices are submitted with 16-bit indices.
+    ImGuiBackendFlags_RendererHasIdxSpans   = 1 << 5,   // Back-end Renderer supports ImDrawList::IdxSpans. This allows ImDrawListSplitter::Merge() (used by Columns) to reference channel indices instead of copying them.
+    ImGuiBackendFlags_RendererHasDirtyRanges= 1 << 6,   // Back-end Renderer supports ImDrawList::VtxDirtyRanges/IdxDirtyRanges and keeps buffers from one frame to the next. Required by io.ConfigDrawListDiff.
+    ImGuiBackendFlags_RendererHasFramebufferSampling = 1 << 7  // Back-end Renderer supports io.WantSampleFramebuffer requests, passing the pixels read back from the framebuffer to io.AddFramebufferSample(). This enables the eyedropper of color pickers.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -1195,6 +1235,8 @@ enum ImGuiColorEditFlags_
     ImGuiColorEditFlags_NoSidePreview   = 1 << 8,   //              // ColorPicker: disable bigger color preview on right side of the picker, use small colored square preview instead.
     ImGuiColorEditFlags_NoDragDrop      = 1 << 9,   //              // ColorEdit: disable drag and drop target. ColorButton: disable drag and drop source.
     ImGuiColorEditFlags_NoBorder        = 1 << 10,  //              // ColorButton: disable border (which is enforced by default)
+    ImGuiColorEditFlags_NoEyedropper    = 1 << 11,  //              // ColorPicker: disable the eyedropper button under the side preview (only available with ImGuiBackendFlags_RendererHasFramebufferSampling).
+    ImGuiColorEditFlags_NoRecentColors  = 1 << 12,  //              // ColorPicker: disable the recent colors under the side preview, and don't add the edited color to them.
 
     // User Options (right-click on widget to change some of them).
     ImGuiColorEditFlags_AlphaBar        = 1 << 16,  //              // ColorEdit, ColorPicker: show vertical alpha bar/gradient in picker.
@@ -1282,6 +1324,7 @@ inline void* operator new(size_t, ImNewDummy, void* ptr) { return ptr; }
 inline void  operator delete(void*, ImNewDummy, void*)   {} // This is only required so we can use the symmetrical new()
 #define IM_ALLOC(_SIZE)                     ImGui::MemAlloc(_SIZE)
 #define IM_FREE(_PTR)                       ImGui::MemFree(_PTR)
+#define IM_ALLOC_FRAME(_SIZE)               ImGui::MemAllocFrame(_SIZE, __FILE__, __LINE__)    // Transient allocation valid until the next NewFrame(), with stats per call-site in Metrics
 #define IM_PLACEMENT_NEW(_PTR)              new(ImNewDummy(), _PTR)
 #define IM_NEW(_TYPE)                       new(ImNewDummy(), ImGui::MemAlloc(sizeof(_TYPE))) _TYPE
 template<typename T> void IM_DELETE(T* p)   { if (p) { p->~T(); ImGui::MemFree(p); } }
@@ -1423,6 +1466,8 @@ struct ImGuiIO
     float       DeltaTime;                      // = 1.0f/60.0f     // Time elapsed since last frame, in seconds.
     float       IniSavingRate;                  // = 5.0f           // Minimum time between saving positions/sizes to .ini file, in seconds.
     const char* IniFilename;                    // = "imgui.ini"    // Path to .ini file. Set NULL to disable automatic .ini loading/saving, if e.g. you want to manually load/save from memory.
+    bool        IniBinaryFormat;                // = false          // Save io.IniFilename in a compact binary format, appending only the entries modified since the last save. Loading detects the format.
+    bool        IniSaveInBackground;            // = false          // Write io.IniFilename from a background thread, replacing the file atomically. Requires IMGUI_ENABLE_SETTINGS_THREAD in imconfig.h, ignored otherwise.
     const char* LogFilename;                    // = "imgui_log.txt"// Path to .log file (default parameter to ImGui::LogToFile when no file is specified).
     float       MouseDoubleClickTime;           // = 0.30f          // Time for a double-click, in seconds.
     float       MouseDoubleClickMaxDist;        // = 6.0f           // Distance threshold to stay in to validate a double-click, in pixels.
@@ -1444,7 +1489,8 @@ struct ImGuiIO
     bool        ConfigInputTextCursorBlink;     // = true           // Set to false to disable blinking cursor, for users who consider it distracting. (was called: io.OptCursorBlink prior to 1.63)
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // [BETA] Set to true to only allow moving windows when clicked+dragged from the title bar. Windows without a title bar are not affected.
-    float       ConfigWindowsMemoryCompactTimer;// = 60.0f          // [BETA] Compact window memory usage when unused. Set to -1.0f to disable.
+    float       ConfigWindowsMemoryCompactTimer;// = 60.0f          // [BETA] Compact window memory usage when unused, and shrink the frame arena after a usage peak. Set to -1.0f to disable.
+    bool        ConfigDrawListDiff;             // = false          // [BETA] Compare each draw list with the previous frame (comparing its buffers by chunks of IM_DRAWLIST_DIFF_CHUNK_SIZE bytes) so the back-end can upload modified ranges only. Requires ImGuiBackendFlags_RendererHasDirtyRanges. Costs CPU time and a copy of the buffers, worth it for mostly static UI. Call ImDrawList::ClearDirtyRanges() to force a full upload.
 
     //------------------------------------------------------------------
     // Platform Functions
@@ -1498,6 +1544,7 @@ struct ImGuiIO
     IMGUI_API void  AddInputCharacterUTF16(ImWchar16 c);        // Queue new character input from an UTF-16 character, it can be a surrogate
     IMGUI_API void  AddInputCharactersUTF8(const char* str);    // Queue new characters input from an UTF-8 string
     IMGUI_API void  ClearInputCharacters();                     // Clear the text input buffer manually
+    IMGUI_API void  AddFramebufferSample(int x, int y, int width, int height, const unsigned int* pixels, int pixels_stride); // Pass RGBA pixels read back from the framebuffer when io.WantSampleFramebuffer is set. (x,y) = position of pixels[0] in framebuffer pixels from the top-left, pixels_stride = distance between rows in pixels (negative for bottom-up data). May be the whole framebuffer (e.g. software rendering).
 
     //------------------------------------------------------------------
     // Output - Updated by NewFrame() or EndFrame()/Render()
@@ -1515,10 +1562,14 @@ struct ImGuiIO
     float       Framerate;                      // Application framerate estimate, in frame per second. Solely for convenience. Rolling average estimation based on io.DeltaTime over 120 frames.
     int         MetricsRenderVertices;          // Vertices output during last call to Render()
     int         MetricsRenderIndices;           // Indices output during last call to Render() = number of triangles * 3
+    int         MetricsRenderDirtyBytes;        // Bytes of vertices and indices modified since the previous frame, during last call to Render(). -1 if draw lists are not compared (see io.ConfigDrawListDiff)
     int         MetricsRenderWindows;           // Number of visible windows
     int         MetricsActiveWindows;           // Number of active windows
     int         MetricsActiveAllocations;       // Number of active allocations, updated by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts.
     ImVec2      MouseDelta;                     // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
+    bool        WantSampleFramebuffer;          // Set during the frame when a color picker eyedropper is active: after rendering, the renderer back-end should read back the region at SampleFramebufferPos and pass it to AddFramebufferSample(). Asynchronous readbacks delivered a few frames later are fine.
+    ImVec2      SampleFramebufferPos;           // Top-left of the region to read back, in framebuffer pixels (io.MousePos * io.DisplayFramebufferScale, minus half the size). May be partially outside of the framebuffer. Only valid while WantSampleFramebuffer is set.
+    int         SampleFramebufferSize;          // Width and height of the region to read back, in framebuffer pixels.
 
     //------------------------------------------------------------------
     // [Internal] Dear ImGui will maintain those fields. Forward compatibility not guaranteed!
@@ -1543,6 +1594,9 @@ struct ImGuiIO
     float       NavInputsDownDurationPrev[ImGuiNavInput_COUNT];
     ImWchar16   InputQueueSurrogate;            // For AddInputCharacterUTF16
     ImVector<ImWchar> InputQueueCharacters;     // Queue of _characters_ input (obtained by platform back-end). Fill using AddInputCharacter() helper.
+    ImVec2      FramebufferSamplePos;           // Position of FramebufferSamplePixels[0] in the framebuffer
+    ImVec2      FramebufferSampleSize;          // Width and height of the part of FramebufferSamplePixels[] starting at FramebufferSamplePos which was covered by the provided pixels (the rest is padding)
+    ImVector<unsigned int> FramebufferSamplePixels; // Last region passed to AddFramebufferSample(), SampleFramebufferSize * SampleFramebufferSize RGBA pixels. Empty until the first sample arrives.
 
     IMGUI_API   ImGuiIO();
 };
@@ -1739,13 +1793,19 @@ struct ImGuiStorage
         ImGuiStoragePair(ImGuiID _key, float _val_f)    { key = _key; val_f = _val_f; }
         ImGuiStoragePair(ImGuiID _key, void* _val_p)    { key = _key; val_p = _val_p; }
     };
+    struct ImGuiStorageSlot
+    {
+        ImGuiID key;
+        int     index;                      // Index into Data[], -1 for an empty slot
+    };
 
     ImVector<ImGuiStoragePair>      Data;
+    ImVector<ImGuiStorageSlot>      HashIndex;      // Empty unless SetHashIndex(true) was called. Open-addressing table (Robin Hood hashing) mapping keys to Data[] indices.
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
+    IMGUI_API void      Clear();
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -1769,6 +1829,10 @@ struct ImGuiStorage
 
     // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
     IMGUI_API void      BuildSortByKey();
+
+    // For storages holding many keys (e.g. tree views with 100k+ nodes: 'ImGui::GetStateStorage()->SetHashIndex(true)'), index pairs with a hash table.
+    // Queries and insertions become O(1) instead of O(log N) queries and O(N) insertions, for 8 bytes per slot of extra memory. Data[] is then unsorted.
+    IMGUI_API void      SetHashIndex(bool enable);
 };
 
 // Helper: Manually clip large list of items.
@@ -1784,6 +1848,21 @@ struct ImGuiStorage
 // - Step 1: the clipper infer height from first element, calculate the actual range of elements to display, and position the cursor before the first element.
 // - (Step 2: dummy step only required if an explicit items_height was passed to constructor or Begin() and user call Step(). Does nothing and switch to Step 3.)
 // - Step 3: the clipper validate that we have reached the expected Y position (corresponding to element DisplayEnd), advance the cursor to the end of the list and then returns 'false' to end the loop.
+// Grid mode: BeginGrid() clips rows of 'items_per_row' items of the same height (e.g. color swatches). DisplayStart/DisplayEnd are item indices, starting a row.
+//     clipper.BeginGrid(500000, 16);
+//     while (clipper.Step())
+//         for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+//         {
+//             if (i % 16 != 0) ImGui::SameLine();
+//             ImGui::ColorButton("##swatch", colors[i]);
+//         }
+// Variable height mode: BeginVariable() measures every submitted item and stores its height in a ImGuiListClipperHeights you keep alive across frames.
+// Step() then returns visible items one at a time, and the heights of items which were never visible are estimated.
+//     static ImGuiListClipperHeights heights;
+//     clipper.BeginVariable(items_count, &heights);
+//     while (clipper.Step())
+//         for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+//             ImGui::TextWrapped("%s", items[i]);
 struct ImGuiListClipper
 {
     int     DisplayStart, DisplayEnd;
@@ -1791,8 +1870,12 @@ struct ImGuiListClipper
 
     // [Internal]
     int     StepNo;
-    float   ItemsHeight;
+    float   ItemsHeight;                        // Height of an item, or of a row of items in grid mode
     float   StartPosY;
+    int     ItemsPerRow;                        // Grid mode
+    ImGuiListClipperHeights* ItemsHeights;      // Variable height mode
+    float   ItemPosY;                           // Variable height mode: position of item DisplayStart
+    float   ClipMaxY;                           // Variable height mode: stop after the first item starting below this position
 
     // items_count:  Use -1 to ignore (you can call Begin later). Use INT_MAX if you don't know how many items you have (in which case the cursor won't be advanced in the final step).
     // items_height: Use -1.0f to be calculated automatically on first step. Otherwise pass in the distance between your items, typically GetTextLineHeightWithSpacing() or GetFrameHeightWithSpacing().
@@ -1803,6 +1886,27 @@ struct ImGuiListClipper
     IMGUI_API bool Step();                                              // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
     IMGUI_API void Begin(int items_count, float items_height = -1.0f);  // Automatically called by constructor if you passed 'items_count' or by Step() in Step 1.
     IMGUI_API void End();                                               // Automatically called on the last call of Step() that returns false.
+    IMGUI_API void BeginGrid(int items_count, int items_per_row, float rows_height = -1.0f);   // Clip rows of 'items_per_row' items. rows_height: distance between rows, or -1.0f to measure the first row.
+    IMGUI_API void BeginVariable(int items_count, ImGuiListClipperHeights* heights);           // Clip items of variable height, using and updating the heights measured on previous frames.
+};
+
+// Helper: Heights of the items of a list, for ImGuiListClipper::BeginVariable(). Keep one instance per list alive across frames.
+// Heights are indexed by a Fenwick tree (binary indexed tree): updating the height of an item, the position of an item and the item at a position are O(log N).
+// Items which were never measured use DefaultHeight (GetTextLineHeightWithSpacing() if <= 0.0f).
+struct ImGuiListClipperHeights
+{
+    ImVector<float>     Heights;                // Height of each item, including spacing
+    ImVector<double>    Tree;                   // Fenwick tree over Heights[] (Tree[0] unused)
+    double              TotalHeight;
+    float               DefaultHeight;
+
+    ImGuiListClipperHeights(float default_height = -1.0f) { TotalHeight = 0.0; DefaultHeight = default_height; }
+    IMGUI_API void      Clear();
+    IMGUI_API void      Resize(int items_count);                // Appended items are O(log N) each. Removing items rebuilds the tree in O(N).
+    IMGUI_API void      SetHeight(int item_n, float height);
+    IMGUI_API double    GetOffset(int item_n) const;            // Sum of the heights of items [0, item_n)
+    IMGUI_API int       FindItem(double offset) const;          // Item containing this offset from the top of the list, clamped to [0, items_count-1]
+    int                 GetCount() const                        { return Heights.Size; }
 };
 
 // Helpers macros to generate 32-bit encoded colors
@@ -1886,12 +1990,42 @@ struct ImDrawCmd
 // Vertex index, default to 16-bit
 // To allow large meshes with 16-bit indices: set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset' and handle ImDrawCmd::VtxOffset in the renderer back-end (recommended).
 // To use 32-bit indices: override with '#define ImDrawIdx unsigned int' in imconfig.h.
+// To use 32-bit indices only where needed: set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasIdxSize' and read ImDrawList::IdxSize in the renderer back-end.
+// This works with either ImDrawIdx: Render() converts the lists with 64K vertices or more to 32-bit indices (16-bit ImDrawIdx) or repacks the others
+// to 16-bit indices (32-bit ImDrawIdx), so only large lists pay for 32-bit indices and they don't need ImDrawCmd::VtxOffset.
 #ifndef ImDrawIdx
 typedef unsigned short ImDrawIdx;
 #endif
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if defined(IMGUI_USE_COMPACT_DRAWVERT)
+// Compact vertex layout (12 bytes instead of 20), enabled with '#define IMGUI_USE_COMPACT_DRAWVERT' in imconfig.h.
+// - pos: signed 16-bit fixed-point with 1/4 pixel precision (raw value = pixel * IM_DRAWVERT_POS_SCALE), covering -8192..+8191.75. Out of range values are clamped.
+// - uv: unsigned normalized 16-bit (0..65535 maps to 0.0f..1.0f). Out of range values are clamped, so wrapping UV cannot be expressed.
+// The member types convert from/to ImVec2 so code writing 'vtx.pos = ImVec2(x, y)' or reading 'ImVec2 p = vtx.pos' is unchanged.
+// Your renderer back-end needs to declare the attributes as GL_SHORT (not normalized, then scaled by 1/IM_DRAWVERT_POS_SCALE) and GL_UNSIGNED_SHORT (normalized).
+#define IM_DRAWVERT_POS_SCALE   4.0f
+struct ImDrawVertPos
+{
+    ImS16   x, y;
+    ImDrawVertPos& operator=(const ImVec2& v)   { x = Quantize(v.x); y = Quantize(v.y); return *this; }
+    operator ImVec2() const                     { return ImVec2(x * (1.0f / IM_DRAWVERT_POS_SCALE), y * (1.0f / IM_DRAWVERT_POS_SCALE)); }
+    static ImS16 Quantize(float f)              { f = f * IM_DRAWVERT_POS_SCALE + (f >= 0.0f ? 0.5f : -0.5f); return (ImS16)(f < -32768.0f ? -32768.0f : f > 32767.0f ? 32767.0f : f); }
+};
+struct ImDrawVertUV
+{
+    ImU16   x, y;
+    ImDrawVertUV& operator=(const ImVec2& v)    { x = Quantize(v.x); y = Quantize(v.y); return *this; }
+    operator ImVec2() const                     { return ImVec2(x * (1.0f / 65535.0f), y * (1.0f / 65535.0f)); }
+    static ImU16 Quantize(float f)              { f = f * 65535.0f + 0.5f; return (ImU16)(f < 0.0f ? 0.0f : f > 65535.0f ? 65535.0f : f); }
+};
+struct ImDrawVert
+{
+    ImDrawVertPos   pos;
+    ImDrawVertUV    uv;
+    ImU32           col;
+};
+#elif !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImDrawVert
 {
     ImVec2  pos;
@@ -1906,6 +2040,22 @@ struct ImDrawVert
 IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT;
 #endif
 
+// A contiguous run of indices within the index stream of a ImDrawList (see ImDrawList::IdxSpans).
+// Indices are read from 'Data' if not NULL (storage owned by the ImDrawList), otherwise from the ImDrawList's own IdxBuffer. Offset and Count are in indices (use ImDrawList::IdxSize for bytes).
+struct ImDrawIdxSpan
+{
+    const void*     Data;
+    int             Offset;
+    int             Count;
+};
+
+// A range of modified bytes in ImDrawList::VtxBuffer or in the index stream of a ImDrawList (see ImDrawList::VtxDirtyRanges, ImDrawList::IdxDirtyRanges).
+struct ImDrawDirtyRange
+{
+    unsigned int    Offset;                 // Offset in bytes
+    unsigned int    Size;                   // Size in bytes
+};
+
 // For use by ImDrawListSplitter.
 struct ImDrawChannel
 {
@@ -1949,7 +2099,10 @@ enum ImDrawListFlags_
     ImDrawListFlags_None             = 0,
     ImDrawListFlags_AntiAliasedLines = 1 << 0,  // Lines are anti-aliased (*2 the number of triangles for 1.0f wide line, otherwise *3 the number of triangles)
     ImDrawListFlags_AntiAliasedFill  = 1 << 1,  // Filled shapes have anti-aliased edges (*2 the number of vertices)
-    ImDrawListFlags_AllowVtxOffset   = 1 << 2   // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AllowVtxOffset   = 1 << 2,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AllowIdxSize     = 1 << 3,  // Render() can change IdxSize: see WidenIdxBuffer(), CompactIdxBuffer(). Set when 'ImGuiBackendFlags_RendererHasIdxSize' is enabled.
+    ImDrawListFlags_AllowIdxSpans    = 1 << 4,  // ImDrawListSplitter::Merge() can reference channel indices through IdxSpans[] instead of copying them into IdxBuffer[]. Set when 'ImGuiBackendFlags_RendererHasIdxSpans' is enabled.
+    ImDrawListFlags_TrackDirtyRanges = 1 << 5   // Render() fills VtxDirtyRanges[]/IdxDirtyRanges[]. Set when 'io.ConfigDrawListDiff' is enabled and 'ImGuiBackendFlags_RendererHasDirtyRanges' is set.
 };
 
 // Draw command list
@@ -1959,14 +2112,20 @@ enum ImDrawListFlags_
 // access the current window draw list and draw custom primitives.
 // You can interleave normal ImGui:: calls and adding primitives to the current draw list.
 // All positions are generally in pixel coordinates (top-left at (0,0), bottom-right at io.DisplaySize), but you are totally free to apply whatever transformation matrix to want to the data (if you apply such transformation you'll want to apply it to ClipRect as well)
-// Important: Primitives are always added to the list and not culled (culling is done at higher-level by ImGui:: functions), if you use this API a lot consider coarse culling your drawn objects.
+// Primitives entirely outside the current clip rectangle are culled on the CPU by AddRectFilled(), AddRectFilledMultiColor(), AddCircle*(), AddNgon*(), AddPolyline(), AddConvexPolyFilled() and AddImage().
+// Partially visible primitives are still fully emitted and clipped by the GPU scissor. Culling at a higher level (as ImGui:: functions do) remains cheaper.
 struct ImDrawList
 {
     // This is what you have to render
     ImVector<ImDrawCmd>     CmdBuffer;          // Draw commands. Typically 1 command = 1 GPU draw call, unless the command is a callback.
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
+    ImVector<ImDrawIdxSpan> IdxSpans;           // Generally empty. Otherwise, the index stream addressed by ImDrawCmd::IdxOffset is the concatenation of those spans, not IdxBuffer (see ImDrawListFlags_AllowIdxSpans)
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
+    unsigned int            IdxSize;            // Size of each index in the index stream, in bytes. == sizeof(ImDrawIdx), unless Render() changed it (see ImDrawListFlags_AllowIdxSize). IdxBuffer.Size is always a number of indices, not of ImDrawIdx.
+    ImVector<ImDrawDirtyRange> VtxDirtyRanges;  // With ImDrawListFlags_TrackDirtyRanges: byte ranges of VtxBuffer[] which changed since DirtyRangesGeneration-1. Bytes past the previous size are always dirty.
+    ImVector<ImDrawDirtyRange> IdxDirtyRanges;  // With ImDrawListFlags_TrackDirtyRanges: byte ranges of the index stream (see IdxSpans[], IdxSize) which changed since DirtyRangesGeneration-1.
+    unsigned int            DirtyRangesGeneration; // Incremented every time dirty ranges are computed. A back-end which didn't upload generation DirtyRangesGeneration-1 of this list needs to upload everything.
 
     // [Internal, used while building lists]
     const ImDrawListSharedData* _Data;          // Pointer to shared draw data (you can use ImGui::GetDrawListSharedData() to get the one from current ImGui context)
@@ -1975,15 +2134,22 @@ struct ImDrawList
     unsigned int            _VtxCurrentIdx;     // [Internal] Generally == VtxBuffer.Size unless we are past 64K vertices, in which case this gets reset to 0.
     ImDrawVert*             _VtxWritePtr;       // [Internal] point within VtxBuffer.Data after each add command (to avoid using the ImVector<> operators too much)
     ImDrawIdx*              _IdxWritePtr;       // [Internal] point within IdxBuffer.Data after each add command (to avoid using the ImVector<> operators too much)
+    int                     _CulledPrimCount;   // [Internal] Number of primitives skipped since Clear() because they were entirely outside the current clip rectangle (displayed in Metrics window)
+    int                     _IdxSpanOwnStart;   // [Internal] Start of the IdxBuffer[] range not yet covered by IdxSpans[]
+    int                     _IdxSpanExtCount;   // [Internal] Number of indices referenced by IdxSpans[] outside of IdxBuffer[]
+    int                     _IdxSpanStorageUsed;// [Internal] Number of _IdxSpanStorage[] buffers in use this frame
+    ImVector<ImVector<ImDrawIdx> > _IdxSpanStorage; // [Internal] Channel index buffers handed over by ImDrawListSplitter::Merge(), recycled across frames
+    ImVector<char>          _VtxPrevious;       // [Internal] Copy of VtxBuffer[] at the last UpdateDirtyRanges() call
+    ImVector<char>          _IdxPrevious;       // [Internal] Copy of the index stream at the last UpdateDirtyRanges() call
     ImVector<ImVec4>        _ClipRectStack;     // [Internal]
     ImVector<ImTextureID>   _TextureIdStack;    // [Internal]
     ImVector<ImVec2>        _Path;              // [Internal] current path building
     ImDrawListSplitter      _Splitter;          // [Internal] for channels api
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData() or create and use your own ImDrawListSharedData (so you can use ImDrawList without ImGui)
-    ImDrawList(const ImDrawListSharedData* shared_data) { _Data = shared_data; _OwnerName = NULL; Clear(); }
+    ImDrawList(const ImDrawListSharedData* shared_data) { _Data = shared_data; _OwnerName = NULL; _IdxSpanStorageUsed = 0; DirtyRangesGeneration = 0; Clear(); }
     ~ImDrawList() { ClearFreeMemory(); }
-    IMGUI_API void  PushClipRect(ImVec2 clip_rect_min, ImVec2 clip_rect_max, bool intersect_with_current_clip_rect = false);  // Render-level scissoring. This is passed down to your render function but not used for CPU-side coarse clipping. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
+    IMGUI_API void  PushClipRect(ImVec2 clip_rect_min, ImVec2 clip_rect_max, bool intersect_with_current_clip_rect = false);  // Render-level scissoring. This is passed down to your render function and used to cull primitives that are entirely outside of it. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
     IMGUI_API void  PushClipRectFullScreen();
     IMGUI_API void  PopClipRect();
     IMGUI_API void  PushTextureID(ImTextureID texture_id);
@@ -2060,6 +2226,13 @@ struct ImDrawList
     inline    void  PrimWriteVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col){ _VtxWritePtr->pos = pos; _VtxWritePtr->uv = uv; _VtxWritePtr->col = col; _VtxWritePtr++; _VtxCurrentIdx++; }
     inline    void  PrimWriteIdx(ImDrawIdx idx)                                 { *_IdxWritePtr = idx; _IdxWritePtr++; }
     inline    void  PrimVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)     { PrimWriteIdx((ImDrawIdx)_VtxCurrentIdx); PrimWriteVtx(pos, uv, col); }
+    inline    int   GetIdxCount() const                                         { return IdxBuffer.Size + _IdxSpanExtCount; } // Size of the index stream, including indices referenced by IdxSpans[]
+    IMGUI_API unsigned int GetIdx(int n) const;                                 // Read index 'n' of the index stream, regardless of IdxSize and IdxSpans[]. Slow, for debugging tools.
+    IMGUI_API void  CompactIdxBuffer();                                         // Repack IdxBuffer[] to 16-bit indices in place if all indices fit (32-bit ImDrawIdx only). Called by Render() when ImDrawListFlags_AllowIdxSize is set.
+    IMGUI_API void  WidenIdxBuffer();                                           // Convert a list split with ImDrawCmd::VtxOffset to 32-bit indices in IdxBuffer[], flattening IdxSpans[] (16-bit ImDrawIdx only). Called by Render() when ImDrawListFlags_AllowIdxSize is set.
+    IMGUI_API void  CloseIdxSpans();                                            // Add the trailing IdxBuffer[] range to IdxSpans[] if used. Called by Render().
+    IMGUI_API void  UpdateDirtyRanges();                                        // Hash buffers by chunks and fill VtxDirtyRanges[]/IdxDirtyRanges[] with chunks modified since the last call. Called by Render() when ImDrawListFlags_TrackDirtyRanges is set.
+    IMGUI_API void  ClearDirtyRanges();                                         // Forget previous buffers so that the next UpdateDirtyRanges() call reports everything as dirty. Call if you modify buffers after Render().
     IMGUI_API void  UpdateClipRect();
     IMGUI_API void  UpdateTextureID();
 };
@@ -2072,8 +2245,10 @@ struct ImDrawData
     bool            Valid;                  // Only valid after Render() is called and before the next NewFrame() is called.
     ImDrawList**    CmdLists;               // Array of ImDrawList* to render. The ImDrawList are owned by ImGuiContext and only pointed to from here.
     int             CmdListsCount;          // Number of ImDrawList* to render
-    int             TotalIdxCount;          // For convenience, sum of all ImDrawList's IdxBuffer.Size
+    int             TotalIdxCount;          // For convenience, sum of all ImDrawList's GetIdxCount()
     int             TotalVtxCount;          // For convenience, sum of all ImDrawList's VtxBuffer.Size
+    bool            HasDirtyRanges;         // All ImDrawList have valid VtxDirtyRanges[]/IdxDirtyRanges[] (see io.ConfigDrawListDiff). If false, upload everything.
+    int             TotalDirtyBytes;        // For convenience, sum of all ImDrawList's dirty ranges sizes (vertices and indices), only valid if HasDirtyRanges.
     ImVec2          DisplayPos;             // Upper-left position of the viewport to render (== upper-left of the orthogonal projection matrix to use)
     ImVec2          DisplaySize;            // Size of the viewport to render (== io.DisplaySize for the main viewport) (DisplayPos + DisplaySize == lower-right of the orthogonal projection matrix to use)
     ImVec2          FramebufferScale;       // Amount of pixels for each unit of DisplaySize. Based on io.DisplayFramebufferScale. Generally (1,1) on normal display, (2,2) on OSX with Retina display.
@@ -2081,7 +2256,7 @@ struct ImDrawData
     // Functions
     ImDrawData()    { Valid = false; Clear(); }
     ~ImDrawData()   { Clear(); }
-    void Clear()    { Valid = false; CmdLists = NULL; CmdListsCount = TotalVtxCount = TotalIdxCount = 0; DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.f, 0.f); } // The ImDrawList are owned by ImGuiContext!
+    void Clear()    { Valid = false; CmdLists = NULL; CmdListsCount = TotalVtxCount = TotalIdxCount = TotalDirtyBytes = 0; HasDirtyRanges = false; DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.f, 0.f); } // The ImDrawList are owned by ImGuiContext!
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
 };
@@ -2161,13 +2336,15 @@ enum ImFontAtlasFlags_
 {
     ImFontAtlasFlags_None               = 0,
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
-    ImFontAtlasFlags_NoMouseCursors     = 1 << 1    // Don't build software mouse cursors into the atlas
+    ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas
+    ImFontAtlasFlags_NoCheckerboard     = 1 << 2    // Don't build the checkerboard used to preview translucent colors into the atlas (they will be rendered with one rectangle per cell)
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
 //  - One or more fonts.
 //  - Custom graphics data needed to render the shapes needed by Dear ImGui.
 //  - Mouse cursor shapes for software cursor rendering (unless setting 'Flags |= ImFontAtlasFlags_NoMouseCursors' in the font atlas).
+//  - A checkerboard used to preview translucent colors (unless setting 'Flags |= ImFontAtlasFlags_NoCheckerboard' in the font atlas).
 // It is the user-code responsibility to setup/build the atlas, then upload the pixel data into a texture accessible by your graphics api.
 //  - Optionally, call any of the AddFont*** functions. If you don't call any, the default font embedded in the code will be loaded for you.
 //  - Call GetTexDataAsAlpha8() or GetTexDataAsRGBA32() to build and retrieve pixels data.
@@ -2244,7 +2421,7 @@ struct ImFontAtlas
     // Members
     //-------------------------------------------
 
-    bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
+    bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert. With IMGUI_ENABLE_THREAD_LOCAL_CONTEXT, contexts never lock/unlock a shared atlas (not owned by the context): set this yourself once it is built, before any context uses it, and clear it only while no context is in a frame.
     ImFontAtlasFlags            Flags;              // Build flags (see ImFontAtlasFlags_)
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
@@ -2258,10 +2435,11 @@ struct ImFontAtlas
     int                         TexHeight;          // Texture height calculated during Build().
     ImVec2                      TexUvScale;         // = (1.0f/TexWidth, 1.0f/TexHeight)
     ImVec2                      TexUvWhitePixel;    // Texture coordinates to a white pixel
+    ImVec4                      TexUvCheckerboard;  // Texture coordinates (min.xy, max.xy) of an 8x8 cells checkerboard, opaque where (cell_x + cell_y) is even. Zero if not built.
     ImVector<ImFont*>           Fonts;              // Hold all the fonts returned by AddFont*. Fonts[0] is the default font upon calling ImGui::NewFrame(), use ImGui::PushFont()/PopFont() to change the current font.
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Internal data
-    int                         CustomRectIds[1];   // Identifiers of custom texture rectangle used by ImFontAtlas/ImDrawList
+    int                         CustomRectIds[2];   // Identifiers of custom texture rectangle used by ImFontAtlas/ImDrawList
 
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     typedef ImFontAtlasCustomRect    CustomRect;         // OBSOLETED in 1.72+
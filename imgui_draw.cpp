@@ -380,12 +380,21 @@ void ImDrawList::Clear()
 {
     CmdBuffer.resize(0);
     IdxBuffer.resize(0);
+    IdxSpans.resize(0);
     VtxBuffer.resize(0);
+    VtxDirtyRanges.resize(0);
+    IdxDirtyRanges.resize(0);
     Flags = _Data ? _Data->InitialFlags : ImDrawListFlags_None;
+    IdxSize = sizeof(ImDrawIdx);
     _VtxCurrentOffset = 0;
     _VtxCurrentIdx = 0;
     _VtxWritePtr = NULL;
     _IdxWritePtr = NULL;
+    _CulledPrimCount = 0;
+    _IdxSpanOwnStart = _IdxSpanExtCount = 0;
+    for (int i = 0; i < _IdxSpanStorageUsed; i++)
+        _IdxSpanStorage[i].resize(0);
+    _IdxSpanStorageUsed = 0;
     _ClipRectStack.resize(0);
     _TextureIdStack.resize(0);
     _Path.resize(0);
@@ -396,10 +405,22 @@ void ImDrawList::ClearFreeMemory()
 {
     CmdBuffer.clear();
     IdxBuffer.clear();
+    IdxSpans.clear();
     VtxBuffer.clear();
+    VtxDirtyRanges.clear();
+    IdxDirtyRanges.clear();
+    _VtxPrevious.clear();
+    _IdxPrevious.clear();
+    IdxSize = sizeof(ImDrawIdx);
     _VtxCurrentIdx = 0;
     _VtxWritePtr = NULL;
     _IdxWritePtr = NULL;
+    _CulledPrimCount = 0;
+    _IdxSpanOwnStart = _IdxSpanExtCount = 0;
+    for (int i = 0; i < _IdxSpanStorage.Size; i++)
+        _IdxSpanStorage[i].clear();
+    _IdxSpanStorage.clear();
+    _IdxSpanStorageUsed = 0;
     _ClipRectStack.clear();
     _TextureIdStack.clear();
     _Path.clear();
@@ -408,11 +429,36 @@ void ImDrawList::ClearFreeMemory()
 
 ImDrawList* ImDrawList::CloneOutput() const
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
     ImDrawList* dst = IM_NEW(ImDrawList(_Data));
     dst->CmdBuffer = CmdBuffer;
-    dst->IdxBuffer = IdxBuffer;
     dst->VtxBuffer = VtxBuffer;
+    if (IdxSpans.Size == 0 && IdxSize > sizeof(ImDrawIdx))
+    {
+        // Widened by WidenIdxBuffer(): IdxBuffer[] holds more than IdxBuffer.Size elements
+        dst->IdxBuffer.reserve(IdxBuffer.Size * (int)(IdxSize / sizeof(ImDrawIdx)));
+        dst->IdxBuffer.Size = IdxBuffer.Size;
+        memcpy(dst->IdxBuffer.Data, IdxBuffer.Data, (size_t)IdxBuffer.Size * IdxSize);
+    }
+    else if (IdxSpans.Size == 0)
+    {
+        dst->IdxBuffer = IdxBuffer;
+    }
+    else
+    {
+        // Flatten index spans, the clone doesn't own our span storage
+        dst->IdxBuffer.resize(GetIdxCount());
+        char* idx_write = (char*)(void*)dst->IdxBuffer.Data;
+        for (int n = 0; n < IdxSpans.Size; n++)
+        {
+            const ImDrawIdxSpan& span = IdxSpans[n];
+            const char* src = (const char*)(span.Data ? span.Data : (const void*)IdxBuffer.Data) + span.Offset * IdxSize;
+            memcpy(idx_write, src, span.Count * IdxSize);
+            idx_write += span.Count * IdxSize;
+        }
+    }
     dst->Flags = Flags;
+    dst->IdxSize = IdxSize;
     return dst;
 }
 
@@ -422,11 +468,12 @@ ImDrawList* ImDrawList::CloneOutput() const
 
 void ImDrawList::AddDrawCmd()
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
     ImDrawCmd draw_cmd;
     draw_cmd.ClipRect = GetCurrentClipRect();
     draw_cmd.TextureId = GetCurrentTextureId();
     draw_cmd.VtxOffset = _VtxCurrentOffset;
-    draw_cmd.IdxOffset = IdxBuffer.Size;
+    draw_cmd.IdxOffset = IdxBuffer.Size + _IdxSpanExtCount;
 
     IM_ASSERT(draw_cmd.ClipRect.x <= draw_cmd.ClipRect.z && draw_cmd.ClipRect.y <= draw_cmd.ClipRect.w);
     CmdBuffer.push_back(draw_cmd);
@@ -489,9 +536,10 @@ void ImDrawList::UpdateTextureID()
 #undef GetCurrentClipRect
 #undef GetCurrentTextureId
 
-// Render-level scissoring. This is passed down to your render function but not used for CPU-side coarse clipping. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
+// Render-level scissoring. This is passed down to your render function and used to cull primitives that are entirely outside of it. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
 void ImDrawList::PushClipRect(ImVec2 cr_min, ImVec2 cr_max, bool intersect_with_current_clip_rect)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
     ImVec4 cr(cr_min.x, cr_min.y, cr_max.x, cr_max.y);
     if (intersect_with_current_clip_rect && _ClipRectStack.Size)
     {
@@ -522,6 +570,7 @@ void ImDrawList::PopClipRect()
 
 void ImDrawList::PushTextureID(ImTextureID texture_id)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
     _TextureIdStack.push_back(texture_id);
     UpdateTextureID();
 }
@@ -538,9 +587,10 @@ void ImDrawList::PopTextureID()
 // submit the intermediate results. PrimUnreserve() can be used to release unused allocations.
 void ImDrawList::PrimReserve(int idx_count, int vtx_count)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
     // Large mesh support (when enabled)
     IM_ASSERT_PARANOID(idx_count >= 0 && vtx_count >= 0);
-    if (sizeof(ImDrawIdx) == 2 && (_VtxCurrentIdx + vtx_count >= (1 << 16)) && (Flags & ImDrawListFlags_AllowVtxOffset))
+    if (sizeof(ImDrawIdx) == 2 && (_VtxCurrentIdx + vtx_count >= (1 << 16)) && (Flags & (ImDrawListFlags_AllowVtxOffset | ImDrawListFlags_AllowIdxSize)))
     {
         _VtxCurrentOffset = VtxBuffer.Size;
         _VtxCurrentIdx = 0;
@@ -570,6 +620,190 @@ void ImDrawList::PrimUnreserve(int idx_count, int vtx_count)
     IdxBuffer.shrink(IdxBuffer.Size - idx_count);
 }
 
+unsigned int ImDrawList::GetIdx(int n) const
+{
+    const void* data = IdxBuffer.Data;
+    for (int span_n = 0; span_n < IdxSpans.Size; span_n++)
+    {
+        const ImDrawIdxSpan& span = IdxSpans[span_n];
+        if (n < span.Count)
+        {
+            data = span.Data ? span.Data : (const void*)IdxBuffer.Data;
+            n += span.Offset;
+            break;
+        }
+        n -= span.Count;
+    }
+    if (IdxSize == sizeof(ImDrawIdx))
+        return ((const ImDrawIdx*)data)[n];
+    if (IdxSize == 2)
+    {
+        ImU16 idx;
+        memcpy(&idx, (const char*)data + n * sizeof(ImU16), sizeof(idx)); // The storage is typed ImDrawIdx: don't read it through a ImU16 pointer
+        return idx;
+    }
+    ImU32 idx;
+    memcpy(&idx, (const char*)data + n * sizeof(ImU32), sizeof(idx));
+    return idx;
+}
+
+// The storage is typed ImDrawIdx: write the 16-bit indices with memcpy() rather than through an aliasing ImU16 pointer (compilers turn it into plain loads/stores)
+static void CompactIdxRange(void* data, int count)
+{
+    char* bytes = (char*)data;
+    for (int n = 0; n < count; n++)
+    {
+        ImDrawIdx src;
+        memcpy(&src, bytes + n * sizeof(ImDrawIdx), sizeof(src));
+        const ImU16 dst = (ImU16)src;
+        memcpy(bytes + n * sizeof(ImU16), &dst, sizeof(dst));
+    }
+}
+
+// With 32-bit ImDrawIdx, lists with less than 64K vertices can be uploaded with 16-bit indices instead.
+// We repack in place: destination index n overlaps source bytes we have already read, so no extra buffer is needed.
+// VtxOffset is never used with 32-bit indices, so all indices are < VtxBuffer.Size.
+void ImDrawList::CompactIdxBuffer()
+{
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
+    if (sizeof(ImDrawIdx) == 2 || IdxSize == 2 || VtxBuffer.Size > (1 << 16))
+        return;
+    CompactIdxRange(IdxBuffer.Data, IdxBuffer.Size);
+    for (int n = 0; n < _IdxSpanStorageUsed; n++)
+        CompactIdxRange(_IdxSpanStorage[n].Data, _IdxSpanStorage[n].Size);
+    IdxSize = 2;
+}
+
+// With 16-bit ImDrawIdx, lists reaching 64K vertices were split with ImDrawCmd::VtxOffset while building (see PrimReserve).
+// Convert them to 32-bit indices with the offsets applied, so the back-end doesn't need VtxOffset and can draw them with fewer calls.
+// We convert in place, walking the index stream backward: 32-bit index n overwrites 16-bit indices 2n and 2n+1 of IdxBuffer[], which
+// are read at stream position 2n or later. IdxSpans[] are flattened in the process. IdxBuffer.Size stays the number of indices.
+void ImDrawList::WidenIdxBuffer()
+{
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
+    if (sizeof(ImDrawIdx) != 2 || IdxSize != 2 || _VtxCurrentOffset == 0)
+        return;
+    IM_ASSERT(_IdxSpanOwnStart == IdxBuffer.Size || IdxSpans.Size == 0); // Call CloseIdxSpans() first
+    const int idx_count = GetIdxCount();
+    IdxBuffer.reserve(idx_count * 2);
+    char* idx_data = (char*)(void*)IdxBuffer.Data;
+
+    int span_n = IdxSpans.Size - 1;
+    int span_start = (span_n >= 0) ? idx_count - IdxSpans[span_n].Count : 0;
+    for (int cmd_n = CmdBuffer.Size - 1; cmd_n >= 0; cmd_n--)
+    {
+        ImDrawCmd& cmd = CmdBuffer.Data[cmd_n];
+        for (int n = (int)(cmd.IdxOffset + cmd.ElemCount) - 1; n >= (int)cmd.IdxOffset; n--)
+        {
+            const char* src = idx_data + n * sizeof(ImU16);
+            if (span_n >= 0)
+            {
+                while (n < span_start && span_n > 0)
+                    span_start -= IdxSpans[--span_n].Count;
+                const ImDrawIdxSpan& span = IdxSpans[span_n];
+                src = (const char*)(span.Data ? span.Data : (const void*)idx_data) + (span.Offset + n - span_start) * sizeof(ImU16);
+            }
+            ImU16 idx16;
+            memcpy(&idx16, src, sizeof(idx16));
+            const ImU32 idx32 = idx16 + cmd.VtxOffset;
+            memcpy(idx_data + n * sizeof(ImU32), &idx32, sizeof(idx32));
+        }
+        cmd.VtxOffset = 0;
+    }
+    IdxBuffer.Size = idx_count;
+    IdxSpans.resize(0);
+    _IdxSpanOwnStart = idx_count;
+    _IdxSpanExtCount = 0;
+    IdxSize = 4;
+
+    // Merge the commands which were only split by VtxOffset
+    int cmd_write = 0;
+    for (int cmd_n = 1; cmd_n < CmdBuffer.Size; cmd_n++)
+    {
+        ImDrawCmd& prev = CmdBuffer.Data[cmd_write];
+        ImDrawCmd& cmd = CmdBuffer.Data[cmd_n];
+        if (!prev.UserCallback && !cmd.UserCallback && prev.TextureId == cmd.TextureId && memcmp(&prev.ClipRect, &cmd.ClipRect, sizeof(cmd.ClipRect)) == 0 && prev.IdxOffset + prev.ElemCount == cmd.IdxOffset)
+            prev.ElemCount += cmd.ElemCount;
+        else
+            CmdBuffer.Data[++cmd_write] = cmd;
+    }
+    if (CmdBuffer.Size > 0)
+        CmdBuffer.Size = cmd_write + 1;
+}
+
+void ImDrawList::CloseIdxSpans()
+{
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
+    if (IdxSpans.Size == 0 || _IdxSpanOwnStart == IdxBuffer.Size)
+        return;
+    ImDrawIdxSpan span = { NULL, _IdxSpanOwnStart, IdxBuffer.Size - _IdxSpanOwnStart };
+    IdxSpans.push_back(span);
+    _IdxSpanOwnStart = IdxBuffer.Size;
+}
+
+// Compare 'data', which is at 'stream_offset' in the stream, by chunks with the copy made by the previous frame and append modified chunks
+// to 'out_ranges' as coalesced byte ranges. 'prev_data' was already resized to the new stream size, 'prev_data_size' is the previous size.
+// We compare bytes rather than hashes: a hash collision would silently leave stale data in the back-end buffers.
+static void DrawListDiffBuffer(const void* data, int data_size, int stream_offset, ImVector<char>& prev_data, int prev_data_size, ImVector<ImDrawDirtyRange>& out_ranges)
+{
+    for (int data_offset = 0; data_offset < data_size; data_offset += IM_DRAWLIST_DIFF_CHUNK_SIZE)
+    {
+        const int size = ImMin(IM_DRAWLIST_DIFF_CHUNK_SIZE, data_size - data_offset);
+        const int offset = stream_offset + data_offset;
+        const char* chunk = (const char*)data + data_offset;
+        if (offset + size <= prev_data_size && memcmp(prev_data.Data + offset, chunk, (size_t)size) == 0)
+            continue;
+        memcpy(prev_data.Data + offset, chunk, (size_t)size);
+        if (out_ranges.Size > 0 && out_ranges.back().Offset + out_ranges.back().Size == (unsigned int)offset)
+        {
+            out_ranges.back().Size += (unsigned int)size;
+        }
+        else
+        {
+            ImDrawDirtyRange range = { (unsigned int)offset, (unsigned int)size };
+            out_ranges.push_back(range);
+        }
+    }
+}
+
+void ImDrawList::UpdateDirtyRanges()
+{
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
+    const int vtx_prev_size = _VtxPrevious.Size;
+    _VtxPrevious.resize(VtxBuffer.Size * (int)sizeof(ImDrawVert));
+    VtxDirtyRanges.resize(0);
+    DrawListDiffBuffer(VtxBuffer.Data, _VtxPrevious.Size, 0, _VtxPrevious, vtx_prev_size, VtxDirtyRanges);
+
+    // The index stream is compared span by span, at the stream offset of each span
+    const int idx_prev_size = _IdxPrevious.Size;
+    _IdxPrevious.resize(GetIdxCount() * (int)IdxSize);
+    IdxDirtyRanges.resize(0);
+    if (IdxSpans.Size == 0)
+    {
+        DrawListDiffBuffer(IdxBuffer.Data, _IdxPrevious.Size, 0, _IdxPrevious, idx_prev_size, IdxDirtyRanges);
+    }
+    else
+    {
+        int stream_offset = 0;
+        for (int span_n = 0; span_n < IdxSpans.Size; span_n++)
+        {
+            const ImDrawIdxSpan& span = IdxSpans[span_n];
+            const char* span_data = (const char*)(span.Data ? span.Data : (const void*)IdxBuffer.Data) + span.Offset * IdxSize;
+            DrawListDiffBuffer(span_data, span.Count * (int)IdxSize, stream_offset, _IdxPrevious, idx_prev_size, IdxDirtyRanges);
+            stream_offset += span.Count * (int)IdxSize;
+        }
+    }
+    DirtyRangesGeneration++;
+}
+
+void ImDrawList::ClearDirtyRanges()
+{
+    VtxDirtyRanges.resize(0);
+    IdxDirtyRanges.resize(0);
+    _VtxPrevious.resize(0);
+    _IdxPrevious.resize(0);
+}
+
 // Fully unrolled with inline call to keep our debug builds decently fast.
 void ImDrawList::PrimRect(const ImVec2& a, const ImVec2& c, ImU32 col)
 {
@@ -615,6 +849,30 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
     _IdxWritePtr += 6;
 }
 
+// CPU-side coarse culling: return true if the (x1,y1)-(x2,y2) bounding box, grown by 'pad', is entirely outside the current clip rectangle.
+// The scissor would discard those pixels anyway, so we save the tessellation, vertex memory and upload. 'pad' covers AA fringes and half stroke thickness.
+// The corners may be in any order: inverted rectangles are valid input (e.g. AddRectFilled() for the negative bars of a histogram).
+static inline bool DrawListCullRect(ImDrawList* draw_list, float x1, float y1, float x2, float y2, float pad)
+{
+    const ImVec4& cr = draw_list->_ClipRectStack.Size ? draw_list->_ClipRectStack.Data[draw_list->_ClipRectStack.Size-1] : draw_list->_Data->ClipRectFullscreen;
+    if (ImMax(x1, x2) + pad >= cr.x && ImMax(y1, y2) + pad >= cr.y && ImMin(x1, x2) - pad <= cr.z && ImMin(y1, y2) - pad <= cr.w)
+        return false;
+    draw_list->_CulledPrimCount++;
+    return true;
+}
+
+static inline bool DrawListCullPoints(ImDrawList* draw_list, const ImVec2* points, const int points_count, float pad)
+{
+    float x1 = points[0].x, y1 = points[0].y, x2 = x1, y2 = y1;
+    for (int i = 1; i < points_count; i++)
+    {
+        const float x = points[i].x, y = points[i].y;
+        if (x < x1) x1 = x; else if (x > x2) x2 = x;
+        if (y < y1) y1 = y; else if (y > y2) y2 = y;
+    }
+    return DrawListCullRect(draw_list, x1, y1, x2, y2, pad);
+}
+
 // On AddPolyline() and AddConvexPolyFilled() we intentionally avoid using ImVec2 and superflous function calls to optimize debug/non-inlined builds.
 // Those macros expects l-values.
 #define IM_NORMALIZE2F_OVER_ZERO(VX,VY)     do { float d2 = VX*VX + VY*VY; if (d2 > 0.0f) { float inv_len = 1.0f / ImSqrt(d2); VX *= inv_len; VY *= inv_len; } } while (0)
@@ -626,6 +884,8 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
 {
     if (points_count < 2)
         return;
+    if (DrawListCullPoints(this, points, points_count, thickness * 0.5f + 1.0f))
+        return;
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
 
@@ -795,10 +1055,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             dx *= (thickness * 0.5f);
             dy *= (thickness * 0.5f);
 
-            _VtxWritePtr[0].pos.x = p1.x + dy; _VtxWritePtr[0].pos.y = p1.y - dx; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
-            _VtxWritePtr[1].pos.x = p2.x + dy; _VtxWritePtr[1].pos.y = p2.y - dx; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
-            _VtxWritePtr[2].pos.x = p2.x - dy; _VtxWritePtr[2].pos.y = p2.y + dx; _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col;
-            _VtxWritePtr[3].pos.x = p1.x - dy; _VtxWritePtr[3].pos.y = p1.y + dx; _VtxWritePtr[3].uv = uv; _VtxWritePtr[3].col = col;
+            _VtxWritePtr[0].pos = ImVec2(p1.x + dy, p1.y - dx); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
+            _VtxWritePtr[1].pos = ImVec2(p2.x + dy, p2.y - dx); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
+            _VtxWritePtr[2].pos = ImVec2(p2.x - dy, p2.y + dx); _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col;
+            _VtxWritePtr[3].pos = ImVec2(p1.x - dy, p1.y + dx); _VtxWritePtr[3].uv = uv; _VtxWritePtr[3].col = col;
             _VtxWritePtr += 4;
 
             _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx+1); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx+2);
@@ -814,6 +1074,8 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
 {
     if (points_count < 3)
         return;
+    if (DrawListCullPoints(this, points, points_count, 1.0f))
+        return;
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
 
@@ -860,8 +1122,8 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             dm_y *= AA_SIZE * 0.5f;
 
             // Add vertices
-            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
-            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
+            _VtxWritePtr[0].pos = ImVec2(points[i1].x - dm_x, points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
+            _VtxWritePtr[1].pos = ImVec2(points[i1].x + dm_x, points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
             _VtxWritePtr += 2;
 
             // Add indexes for fringes
@@ -893,6 +1155,7 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
 
 void ImDrawList::PathArcToFast(const ImVec2& center, float radius, int a_min_of_12, int a_max_of_12)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
     if (radius == 0.0f || a_min_of_12 > a_max_of_12)
     {
         _Path.push_back(center);
@@ -916,6 +1179,7 @@ void ImDrawList::PathArcToFast(const ImVec2& center, float radius, int a_min_of_
 
 void ImDrawList::PathArcTo(const ImVec2& center, float radius, float a_min, float a_max, int num_segments)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
     if (radius == 0.0f)
     {
         _Path.push_back(center);
@@ -970,6 +1234,7 @@ static void PathBezierToCasteljau(ImVector<ImVec2>* path, float x1, float y1, fl
 
 void ImDrawList::PathBezierCurveTo(const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, int num_segments)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
     ImVec2 p1 = _Path.back();
     if (num_segments == 0)
     {
@@ -1034,6 +1299,8 @@ void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 c
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (DrawListCullRect(this, p_min.x, p_min.y, p_max.x, p_max.y, 1.0f))
+        return;
     if (rounding > 0.0f)
     {
         PathRect(p_min, p_max, rounding, rounding_corners);
@@ -1051,6 +1318,8 @@ void ImDrawList::AddRectFilledMultiColor(const ImVec2& p_min, const ImVec2& p_ma
 {
     if (((col_upr_left | col_upr_right | col_bot_right | col_bot_left) & IM_COL32_A_MASK) == 0)
         return;
+    if (DrawListCullRect(this, p_min.x, p_min.y, p_max.x, p_max.y, 0.0f))
+        return;
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
     PrimReserve(6, 4);
@@ -1112,6 +1381,8 @@ void ImDrawList::AddCircle(const ImVec2& center, float radius, ImU32 col, int nu
 {
     if ((col & IM_COL32_A_MASK) == 0 || radius <= 0.0f)
         return;
+    if (DrawListCullRect(this, center.x - radius, center.y - radius, center.x + radius, center.y + radius, thickness * 0.5f + 1.0f))
+        return;
 
     // Obtain segment count
     if (num_segments <= 0)
@@ -1142,6 +1413,8 @@ void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col,
 {
     if ((col & IM_COL32_A_MASK) == 0 || radius <= 0.0f)
         return;
+    if (DrawListCullRect(this, center.x - radius, center.y - radius, center.x + radius, center.y + radius, 1.0f))
+        return;
 
     // Obtain segment count
     if (num_segments <= 0)
@@ -1173,6 +1446,8 @@ void ImDrawList::AddNgon(const ImVec2& center, float radius, ImU32 col, int num_
 {
     if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
         return;
+    if (DrawListCullRect(this, center.x - radius, center.y - radius, center.x + radius, center.y + radius, thickness * 0.5f + 1.0f))
+        return;
 
     // Because we are filling a closed shape we remove 1 from the count of segments/points
     const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
@@ -1185,6 +1460,8 @@ void ImDrawList::AddNgonFilled(const ImVec2& center, float radius, ImU32 col, in
 {
     if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
         return;
+    if (DrawListCullRect(this, center.x - radius, center.y - radius, center.x + radius, center.y + radius, 1.0f))
+        return;
 
     // Because we are filling a closed shape we remove 1 from the count of segments/points
     const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
@@ -1241,6 +1518,8 @@ void ImDrawList::AddImage(ImTextureID user_texture_id, const ImVec2& p_min, cons
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (DrawListCullRect(this, p_min.x, p_min.y, p_max.x, p_max.y, 0.0f))
+        return;
 
     const bool push_texture_id = _TextureIdStack.empty() || user_texture_id != _TextureIdStack.back();
     if (push_texture_id)
@@ -1317,6 +1596,7 @@ void ImDrawListSplitter::ClearFreeMemory()
 
 void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
     IM_ASSERT(_Current == 0 && _Count <= 1 && "Nested channel splitting is not supported. Please use separate instances of ImDrawListSplitter.");
     int old_channels_count = _Channels.Size;
     if (old_channels_count < channels_count)
@@ -1355,6 +1635,7 @@ static inline bool CanMergeDrawCommands(ImDrawCmd* a, ImDrawCmd* b)
 
 void ImDrawListSplitter::Merge(ImDrawList* draw_list)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
     // Note that we never use or rely on channels.Size because it is merely a buffer that we never shrink back to 0 to keep all sub-buffers ready for use.
     if (_Count <= 1)
         return;
@@ -1391,18 +1672,48 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
         }
     }
     draw_list->CmdBuffer.resize(draw_list->CmdBuffer.Size + new_cmd_buffer_count);
-    draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
-
-    // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices)
     ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size - new_cmd_buffer_count;
-    ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - new_idx_buffer_count;
-    for (int i = 1; i < _Count; i++)
+
+    if (draw_list->Flags & ImDrawListFlags_AllowIdxSpans)
     {
-        ImDrawChannel& ch = _Channels[i];
-        if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
-        if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
+        // Write commands in order, reference indices without copying them.
+        // The channel index buffers are handed over to the draw list (so they stay valid until rendering even if we Split() again this frame),
+        // and the channels get back buffers recycled from a previous frame, so both sides keep their capacity and we don't allocate in steady state.
+        if (new_idx_buffer_count > 0 && draw_list->_IdxSpanOwnStart < draw_list->IdxBuffer.Size)
+        {
+            ImDrawIdxSpan span = { NULL, draw_list->_IdxSpanOwnStart, draw_list->IdxBuffer.Size - draw_list->_IdxSpanOwnStart };
+            draw_list->IdxSpans.push_back(span);
+            draw_list->_IdxSpanOwnStart = draw_list->IdxBuffer.Size;
+        }
+        for (int i = 1; i < _Count; i++)
+        {
+            ImDrawChannel& ch = _Channels[i];
+            if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
+            if (ch._IdxBuffer.Size == 0)
+                continue;
+            if (draw_list->_IdxSpanStorageUsed == draw_list->_IdxSpanStorage.Size)
+                draw_list->_IdxSpanStorage.push_back(ImVector<ImDrawIdx>());
+            ImVector<ImDrawIdx>& storage = draw_list->_IdxSpanStorage[draw_list->_IdxSpanStorageUsed++];
+            storage.swap(ch._IdxBuffer);
+            ch._IdxBuffer.resize(0);
+            ImDrawIdxSpan span = { storage.Data, 0, storage.Size };
+            draw_list->IdxSpans.push_back(span);
+            draw_list->_IdxSpanExtCount += storage.Size;
+        }
     }
-    draw_list->_IdxWritePtr = idx_write;
+    else
+    {
+        // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices)
+        draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
+        ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - new_idx_buffer_count;
+        for (int i = 1; i < _Count; i++)
+        {
+            ImDrawChannel& ch = _Channels[i];
+            if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
+            if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
+        }
+    }
+    draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size;
     draw_list->UpdateClipRect(); // We call this instead of AddDrawCmd(), so that empty channels won't produce an extra draw call.
     draw_list->UpdateTextureID();
     _Count = 1;
@@ -1430,17 +1741,22 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
 void ImDrawData::DeIndexAllBuffers()
 {
     ImVector<ImDrawVert> new_vtx_buffer;
-    TotalVtxCount = TotalIdxCount = 0;
+    TotalVtxCount = TotalIdxCount = TotalDirtyBytes = 0;
+    HasDirtyRanges = false;
     for (int i = 0; i < CmdListsCount; i++)
     {
         ImDrawList* cmd_list = CmdLists[i];
-        if (cmd_list->IdxBuffer.empty())
+        const int idx_count = cmd_list->GetIdxCount();
+        if (idx_count == 0)
             continue;
-        new_vtx_buffer.resize(cmd_list->IdxBuffer.Size);
-        for (int j = 0; j < cmd_list->IdxBuffer.Size; j++)
-            new_vtx_buffer[j] = cmd_list->VtxBuffer[cmd_list->IdxBuffer[j]];
+        new_vtx_buffer.resize(idx_count);
+        for (int j = 0; j < idx_count; j++)
+            new_vtx_buffer[j] = cmd_list->VtxBuffer[cmd_list->GetIdx(j)];
         cmd_list->VtxBuffer.swap(new_vtx_buffer);
         cmd_list->IdxBuffer.resize(0);
+        cmd_list->IdxSpans.resize(0);
+        cmd_list->_IdxSpanOwnStart = cmd_list->_IdxSpanExtCount = 0;
+        cmd_list->ClearDirtyRanges();
         TotalVtxCount += cmd_list->VtxBuffer.Size;
     }
 }
@@ -1474,7 +1790,7 @@ void ImGui::ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int ve
     ImDrawVert* vert_end = draw_list->VtxBuffer.Data + vert_end_idx;
     for (ImDrawVert* vert = vert_start; vert < vert_end; vert++)
     {
-        float d = ImDot(vert->pos - gradient_p0, gradient_extent);
+        float d = ImDot(ImVec2(vert->pos) - gradient_p0, gradient_extent);
         float t = ImClamp(d * gradient_inv_length2, 0.0f, 1.0f);
         int r = ImLerp((int)(col0 >> IM_COL32_R_SHIFT) & 0xFF, (int)(col1 >> IM_COL32_R_SHIFT) & 0xFF, t);
         int g = ImLerp((int)(col0 >> IM_COL32_G_SHIFT) & 0xFF, (int)(col1 >> IM_COL32_G_SHIFT) & 0xFF, t);
@@ -1499,12 +1815,12 @@ void ImGui::ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int ve
         const ImVec2 min = ImMin(uv_a, uv_b);
         const ImVec2 max = ImMax(uv_a, uv_b);
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale), min, max);
+            vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos) - a, scale), min, max);
     }
     else
     {
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale);
+            vertex->uv = uv_a + ImMul(ImVec2(vertex->pos) - a, scale);
     }
 }
 
@@ -1544,6 +1860,8 @@ ImFontConfig::ImFontConfig()
 const int FONT_ATLAS_DEFAULT_TEX_DATA_W_HALF = 108;
 const int FONT_ATLAS_DEFAULT_TEX_DATA_H      = 27;
 const unsigned int FONT_ATLAS_DEFAULT_TEX_DATA_ID = 0x80000000;
+const unsigned int FONT_ATLAS_CHECKERBOARD_ID = 0x80000001;
+const int FONT_ATLAS_CHECKERBOARD_CELL_SIZE = 8;   // In texels. Large enough that the checkerboard of a typical color swatch is sampled without blurring.
 static const char FONT_ATLAS_DEFAULT_TEX_DATA_PIXELS[FONT_ATLAS_DEFAULT_TEX_DATA_W_HALF * FONT_ATLAS_DEFAULT_TEX_DATA_H + 1] =
 {
     "..-         -XXXXXXX-    X    -           X           -XXXXXXX          -          XXXXXXX-     XX          "
@@ -1601,6 +1919,7 @@ ImFontAtlas::ImFontAtlas()
     TexWidth = TexHeight = 0;
     TexUvScale = ImVec2(0.0f, 0.0f);
     TexUvWhitePixel = ImVec2(0.0f, 0.0f);
+    TexUvCheckerboard = ImVec4(0.0f, 0.0f, 0.0f, 0.0f);
     for (int n = 0; n < IM_ARRAYSIZE(CustomRectIds); n++)
         CustomRectIds[n] = -1;
 }
@@ -1662,6 +1981,7 @@ void    ImFontAtlas::Clear()
 
 void    ImFontAtlas::GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     // Build atlas on demand
     if (TexPixelsAlpha8 == NULL)
     {
@@ -1678,6 +1998,7 @@ void    ImFontAtlas::GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_wid
 
 void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     // Convert to RGBA32 format on demand
     // Although it is likely to be the most commonly used format, our font rendering is 1 channel / 8 bpp
     if (!TexPixelsRGBA32)
@@ -1702,6 +2023,7 @@ void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_wid
 
 ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     IM_ASSERT(font_cfg->FontData != NULL && font_cfg->FontDataSize > 0);
     IM_ASSERT(font_cfg->SizePixels > 0.0f);
@@ -1771,6 +2093,7 @@ ImFont* ImFontAtlas::AddFontDefault(const ImFontConfig* font_cfg_template)
 
 ImFont* ImFontAtlas::AddFontFromFileTTF(const char* filename, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     size_t data_size = 0;
     void* data = ImFileLoadToMemory(filename, "rb", &data_size, 0);
@@ -1806,6 +2129,7 @@ ImFont* ImFontAtlas::AddFontFromMemoryTTF(void* ttf_data, int ttf_size, float si
 
 ImFont* ImFontAtlas::AddFontFromMemoryCompressedTTF(const void* compressed_ttf_data, int compressed_ttf_size, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     const unsigned int buf_decompressed_size = stb_decompress_length((const unsigned char*)compressed_ttf_data);
     unsigned char* buf_decompressed_data = (unsigned char *)IM_ALLOC(buf_decompressed_size);
     stb_decompress(buf_decompressed_data, (const unsigned char*)compressed_ttf_data, (unsigned int)compressed_ttf_size);
@@ -1818,6 +2142,7 @@ ImFont* ImFontAtlas::AddFontFromMemoryCompressedTTF(const void* compressed_ttf_d
 
 ImFont* ImFontAtlas::AddFontFromMemoryCompressedBase85TTF(const char* compressed_ttf_data_base85, float size_pixels, const ImFontConfig* font_cfg, const ImWchar* glyph_ranges)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     int compressed_ttf_size = (((int)strlen(compressed_ttf_data_base85) + 4) / 5) * 4;
     void* compressed_ttf = IM_ALLOC((size_t)compressed_ttf_size);
     Decode85((const unsigned char*)compressed_ttf_data_base85, (unsigned char*)compressed_ttf);
@@ -1828,6 +2153,7 @@ ImFont* ImFontAtlas::AddFontFromMemoryCompressedBase85TTF(const char* compressed
 
 int ImFontAtlas::AddCustomRectRegular(unsigned int id, int width, int height)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     // Breaking change on 2019/11/21 (1.74): ImFontAtlas::AddCustomRectRegular() now requires an ID >= 0x110000 (instead of >= 0x10000)
     IM_ASSERT(id >= 0x110000);
     IM_ASSERT(width > 0 && width <= 0xFFFF);
@@ -1842,6 +2168,7 @@ int ImFontAtlas::AddCustomRectRegular(unsigned int id, int width, int height)
 
 int ImFontAtlas::AddCustomRectFontGlyph(ImFont* font, ImWchar id, int width, int height, float advance_x, const ImVec2& offset)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     IM_ASSERT(font != NULL);
     IM_ASSERT(width > 0 && width <= 0xFFFF);
     IM_ASSERT(height > 0 && height <= 0xFFFF);
@@ -1888,7 +2215,9 @@ bool ImFontAtlas::GetMouseCursorTexData(ImGuiMouseCursor cursor_type, ImVec2* ou
 
 bool    ImFontAtlas::Build()
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    IMGUI_PROFILER_ZONE("ImFontAtlas::Build");
     return ImFontAtlasBuildWithStbTruetype(this);
 }
 
@@ -1957,6 +2286,7 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     atlas->TexWidth = atlas->TexHeight = 0;
     atlas->TexUvScale = ImVec2(0.0f, 0.0f);
     atlas->TexUvWhitePixel = ImVec2(0.0f, 0.0f);
+    atlas->TexUvCheckerboard = ImVec4(0.0f, 0.0f, 0.0f, 0.0f);
     atlas->ClearTexData();
 
     // Temporary storage for building
@@ -2211,6 +2541,10 @@ void ImFontAtlasBuildInit(ImFontAtlas* atlas)
         atlas->CustomRectIds[0] = atlas->AddCustomRectRegular(FONT_ATLAS_DEFAULT_TEX_DATA_ID, FONT_ATLAS_DEFAULT_TEX_DATA_W_HALF*2+1, FONT_ATLAS_DEFAULT_TEX_DATA_H);
     else
         atlas->CustomRectIds[0] = atlas->AddCustomRectRegular(FONT_ATLAS_DEFAULT_TEX_DATA_ID, 2, 2);
+
+    // Checkerboard, with a 1 texel border continuing the pattern so that bilinear filtering at the edges doesn't pick up neighboring data
+    if (!(atlas->Flags & ImFontAtlasFlags_NoCheckerboard))
+        atlas->CustomRectIds[1] = atlas->AddCustomRectRegular(FONT_ATLAS_CHECKERBOARD_ID, IM_FONT_ATLAS_CHECKERBOARD_CELLS * FONT_ATLAS_CHECKERBOARD_CELL_SIZE + 2, IM_FONT_ATLAS_CHECKERBOARD_CELLS * FONT_ATLAS_CHECKERBOARD_CELL_SIZE + 2);
 }
 
 void ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent)
@@ -2283,6 +2617,24 @@ static void ImFontAtlasBuildRenderDefaultTexData(ImFontAtlas* atlas)
         atlas->TexPixelsAlpha8[offset] = atlas->TexPixelsAlpha8[offset + 1] = atlas->TexPixelsAlpha8[offset + w] = atlas->TexPixelsAlpha8[offset + w + 1] = 0xFF;
     }
     atlas->TexUvWhitePixel = ImVec2((r.X + 0.5f) * atlas->TexUvScale.x, (r.Y + 0.5f) * atlas->TexUvScale.y);
+
+    atlas->TexUvCheckerboard = ImVec4(0.0f, 0.0f, 0.0f, 0.0f);
+    if (atlas->CustomRectIds[1] < 0)
+        return;
+    ImFontAtlasCustomRect& r_checker = atlas->CustomRects[atlas->CustomRectIds[1]];
+    IM_ASSERT(r_checker.ID == FONT_ATLAS_CHECKERBOARD_ID);
+    IM_ASSERT(r_checker.IsPacked());
+    const int checker_size = IM_FONT_ATLAS_CHECKERBOARD_CELLS * FONT_ATLAS_CHECKERBOARD_CELL_SIZE;
+    IM_ASSERT(r_checker.Width == checker_size + 2 && r_checker.Height == checker_size + 2);
+    for (int y = 0; y < checker_size + 2; y++)
+        for (int x = 0; x < checker_size + 2; x++)
+        {
+            // Offset by one cell so the border texels (at -1) are mapped to a valid cell of the same parity
+            const int cell_x = (x - 1 + FONT_ATLAS_CHECKERBOARD_CELL_SIZE) / FONT_ATLAS_CHECKERBOARD_CELL_SIZE;
+            const int cell_y = (y - 1 + FONT_ATLAS_CHECKERBOARD_CELL_SIZE) / FONT_ATLAS_CHECKERBOARD_CELL_SIZE;
+            atlas->TexPixelsAlpha8[(int)(r_checker.X + x) + (int)(r_checker.Y + y) * w] = ((cell_x + cell_y) & 1) ? 0x00 : 0xFF;
+        }
+    atlas->TexUvCheckerboard = ImVec4((r_checker.X + 1) * atlas->TexUvScale.x, (r_checker.Y + 1) * atlas->TexUvScale.y, (r_checker.X + 1 + checker_size) * atlas->TexUvScale.x, (r_checker.Y + 1 + checker_size) * atlas->TexUvScale.y);
 }
 
 void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
@@ -2626,6 +2978,7 @@ void    ImFont::ClearOutputData()
 
 void ImFont::BuildLookupTable()
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     int max_codepoint = 0;
     for (int i = 0; i != Glyphs.Size; i++)
         max_codepoint = ImMax(max_codepoint, (int)Glyphs[i].Codepoint);
@@ -2701,6 +3054,7 @@ void ImFont::SetFallbackChar(ImWchar c)
 
 void ImFont::GrowIndex(int new_size)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     IM_ASSERT(IndexAdvanceX.Size == IndexLookup.Size);
     if (new_size <= IndexLookup.Size)
         return;
@@ -2712,6 +3066,7 @@ void ImFont::GrowIndex(int new_size)
 // Not to be mistaken with texture coordinates, which are held by u0/v0/u1/v1 in normalized format (0.0..1.0 on each texture axis).
 void ImFont::AddGlyph(ImWchar codepoint, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     Glyphs.resize(Glyphs.Size + 1);
     ImFontGlyph& glyph = Glyphs.back();
     glyph.Codepoint = (unsigned int)codepoint;
@@ -2736,6 +3091,7 @@ void ImFont::AddGlyph(ImWchar codepoint, float x0, float y0, float x1, float y1,
 
 void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     IM_ASSERT(IndexLookup.Size > 0);    // Currently this can only be called AFTER the font has been built, aka after calling ImFontAtlas::GetTexDataAs*() function.
     unsigned int index_size = (unsigned int)IndexLookup.Size;
 
@@ -3138,10 +3494,10 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
                 {
                     idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+2);
                     idx_write[3] = (ImDrawIdx)(vtx_current_idx); idx_write[4] = (ImDrawIdx)(vtx_current_idx+2); idx_write[5] = (ImDrawIdx)(vtx_current_idx+3);
-                    vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
-                    vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
-                    vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
-                    vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+                    vtx_write[0].pos = ImVec2(x1, y1); vtx_write[0].col = col; vtx_write[0].uv = ImVec2(u1, v1);
+                    vtx_write[1].pos = ImVec2(x2, y1); vtx_write[1].col = col; vtx_write[1].uv = ImVec2(u2, v1);
+                    vtx_write[2].pos = ImVec2(x2, y2); vtx_write[2].col = col; vtx_write[2].uv = ImVec2(u2, v2);
+                    vtx_write[3].pos = ImVec2(x1, y2); vtx_write[3].col = col; vtx_write[3].uv = ImVec2(u1, v2);
                     vtx_write += 4;
                     vtx_current_idx += 4;
                     idx_write += 6;
@@ -3333,6 +3689,9 @@ void ImGui::RenderRectFilledRangeH(ImDrawList* draw_list, const ImRect& rect, Im
 // Helper for ColorPicker4()
 // NB: This is rather brittle and will show artifact when rounding this enabled if rounded corners overlap multiple cells. Caller currently responsible for avoiding that.
 // Spent a non reasonable amount of time trying to getting this right for ColorButton with rounding+anti-aliasing+ImGuiColorEditFlags_HalfAlphaPreview flag + various grid sizes and offsets, and eventually gave up... probably more reasonable to disable rounding alltogether.
+// The dark cells are rendered from the checkerboard baked in the font atlas (see ImFontAtlasFlags_NoCheckerboard): the atlas
+// sub-rectangle can't wrap, so the rectangle is covered with textured quads of (IM_FONT_ATLAS_CHECKERBOARD_CELLS-2) cells,
+// each starting at the same cell parity. A rounded rectangle needs to fit in a single quad, otherwise we fall back to one rectangle per cell.
 // FIXME: uses ImGui::GetColorU32
 void ImGui::RenderColorRectWithAlphaCheckerboard(ImDrawList* draw_list, ImVec2 p_min, ImVec2 p_max, ImU32 col, float grid_step, ImVec2 grid_off, float rounding, int rounding_corners_flags)
 {
@@ -3341,6 +3700,42 @@ void ImGui::RenderColorRectWithAlphaCheckerboard(ImDrawList* draw_list, ImVec2 p
         ImU32 col_bg1 = ImGui::GetColorU32(ImAlphaBlendColors(IM_COL32(204, 204, 204, 255), col));
         ImU32 col_bg2 = ImGui::GetColorU32(ImAlphaBlendColors(IM_COL32(128, 128, 128, 255), col));
         draw_list->AddRectFilled(p_min, p_max, col_bg1, rounding, rounding_corners_flags);
+        if (p_max.x <= p_min.x || p_max.y <= p_min.y)
+            return;
+
+        const ImVec4& uv_checker = draw_list->_Data->TexUvCheckerboard;
+        const float tile_size = (IM_FONT_ATLAS_CHECKERBOARD_CELLS - 2) * grid_step;
+        const int tiles_x = (int)ImCeil((p_max.x - p_min.x) / tile_size);
+        const int tiles_y = (int)ImCeil((p_max.y - p_min.y) / tile_size);
+        const bool rounded = rounding > 0.0f && (rounding_corners_flags & ImDrawCornerFlags_All) != 0;
+        if (uv_checker.z > uv_checker.x && (!rounded || (tiles_x == 1 && tiles_y == 1)))
+        {
+            // Cell coordinates of p_min relative to the grid origin, brought back into [0,2) which preserves the parity
+            ImVec2 cell_min(-grid_off.x / grid_step, -grid_off.y / grid_step);
+            cell_min.x -= 2.0f * ImFloor(cell_min.x * 0.5f);
+            cell_min.y -= 2.0f * ImFloor(cell_min.y * 0.5f);
+            const ImVec2 uv_per_cell((uv_checker.z - uv_checker.x) / IM_FONT_ATLAS_CHECKERBOARD_CELLS, (uv_checker.w - uv_checker.y) / IM_FONT_ATLAS_CHECKERBOARD_CELLS);
+            const ImVec2 uv_min(uv_checker.x + cell_min.x * uv_per_cell.x, uv_checker.y + cell_min.y * uv_per_cell.y);
+            if (rounded)
+            {
+                const ImVec2 uv_max(uv_min.x + (p_max.x - p_min.x) / grid_step * uv_per_cell.x, uv_min.y + (p_max.y - p_min.y) / grid_step * uv_per_cell.y);
+                const int vert_start_idx = draw_list->VtxBuffer.Size;
+                draw_list->AddRectFilled(p_min, p_max, col_bg2, rounding, rounding_corners_flags);
+                ShadeVertsLinearUV(draw_list, vert_start_idx, draw_list->VtxBuffer.Size, p_min, p_max, uv_min, uv_max, true);
+                return;
+            }
+            draw_list->PrimReserve(tiles_x * tiles_y * 6, tiles_x * tiles_y * 4);
+            for (int tile_y = 0; tile_y < tiles_y; tile_y++)
+            {
+                const float y1 = p_min.y + tile_y * tile_size, y2 = ImMin(y1 + tile_size, p_max.y);
+                for (int tile_x = 0; tile_x < tiles_x; tile_x++)
+                {
+                    const float x1 = p_min.x + tile_x * tile_size, x2 = ImMin(x1 + tile_size, p_max.x);
+                    draw_list->PrimRectUV(ImVec2(x1, y1), ImVec2(x2, y2), uv_min, ImVec2(uv_min.x + (x2 - x1) / grid_step * uv_per_cell.x, uv_min.y + (y2 - y1) / grid_step * uv_per_cell.y), col_bg2);
+                }
+            }
+            return;
+        }
 
         int yi = 0;
         for (float y = p_min.y + grid_off.y; y < p_max.y; y += grid_step, yi++)
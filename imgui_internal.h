@@ -77,6 +77,7 @@ struct ImBitVector;                 // Store 1-bit per value
 struct ImRect;                      // An axis-aligned rectangle (2 points)
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
+struct ImGuiColorHistory;           // Storage for the recent colors and the palette of the color pickers
 struct ImGuiColorMod;               // Stacked color modifier, backup of modified data so we can restore it
 struct ImGuiColumnData;             // Storage data for a single column
 struct ImGuiColumns;                // Storage data for a columns set
@@ -89,17 +90,22 @@ struct ImGuiMenuColumns;            // Simple column measurement, currently used
 struct ImGuiNavMoveResult;          // Result of a gamepad/keyboard directional navigation move query result
 struct ImGuiNextWindowData;         // Storage for SetNextWindow** functions
 struct ImGuiNextItemData;           // Storage for SetNextItem** functions
+struct ImGuiPlotCache;              // Storage for the min/max pyramid of a plot (ImGuiPlotFlags_CacheValues)
 struct ImGuiPopupData;              // Storage for current popup stack
+struct ImGuiSettingsBinaryEntry;    // Storage for one entry of a binary .ini file
 struct ImGuiSettingsHandler;        // Storage for one type registered in the .ini file
+struct ImGuiSettingsWriter;         // Background thread writing .ini files (defined in imgui.cpp with IMGUI_ENABLE_SETTINGS_THREAD)
 struct ImGuiStyleMod;               // Stacked style modifier, backup of modified data so we can restore it
 struct ImGuiTabBar;                 // Storage for a tab bar
 struct ImGuiTabItem;                // Storage for a tab item (within a tab bar)
+struct ImGuiTypingSelectIndex;      // Storage for the type-ahead search of Combo() and ListBox()
 struct ImGuiWindow;                 // Storage for one window
 struct ImGuiWindowTempData;         // Temporary storage for one window (that's the data which in theory we could ditch at the end of the frame)
 struct ImGuiWindowSettings;         // Storage for a window .ini settings (we keep one of those even if the actual window wasn't instanced during this session)
 
 // Use your programming IDE "Go to definition" facility on the names of the center columns to find the actual flags/enum lists.
 typedef int ImGuiLayoutType;            // -> enum ImGuiLayoutType_         // Enum: Horizontal or vertical
+typedef int ImGuiMemTag;                // -> enum ImGuiMemTag_             // Enum: Subsystem owning an allocation (with IMGUI_ENABLE_MEMORY_ACCOUNTING)
 typedef int ImGuiButtonFlags;           // -> enum ImGuiButtonFlags_        // Flags: for ButtonEx(), ButtonBehavior()
 typedef int ImGuiColumnsFlags;          // -> enum ImGuiColumnsFlags_       // Flags: BeginColumns()
 typedef int ImGuiDragFlags;             // -> enum ImGuiDragFlags_          // Flags: for DragBehavior()
@@ -137,9 +143,20 @@ namespace ImStb
 // Context pointer
 //-----------------------------------------------------------------------------
 
+// Thread-local storage for POD variables (C++11 thread_local isn't available with every compiler we support)
+#if defined(_MSC_VER)
+#define IM_THREAD_LOCAL                 __declspec(thread)
+#else
+#define IM_THREAD_LOCAL                 __thread
+#endif
+
 #ifndef GImGui
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+extern IMGUI_API IM_THREAD_LOCAL ImGuiContext* GImGui;  // Current implicit context pointer, one per thread
+#else
 extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 #endif
+#endif
 
 //-----------------------------------------------------------------------------
 // Macros
@@ -238,6 +255,9 @@ IMGUI_API const ImWchar*ImStrbolW(const ImWchar* buf_mid_line, const ImWchar* bu
 IMGUI_API const char*   ImStristr(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end);
 IMGUI_API void          ImStrTrimBlanks(char* str);
 IMGUI_API const char*   ImStrSkipBlank(const char* str);
+IMGUI_API const char*   ImStrParseInt(const char* str, int* out_value);                     // Parse a decimal integer (after optional blanks and sign), return the end of the number or NULL if there is none
+IMGUI_API const char*   ImStrParseHex(const char* str, int max_digits, unsigned int* out_value); // Parse up to max_digits hexadecimal digits, return the end of the number or NULL if there is none
+IMGUI_API int           ImFormatStringInt(char* buf, size_t buf_size, const char* fmt, ImU64 v, bool v_is_64bit); // Format one integer without vsnprintf() for simple formats (e.g. "R:%3d", "%08X"). Return -1 if the format isn't supported.
 IMGUI_API int           ImFormatString(char* buf, size_t buf_size, const char* fmt, ...) IM_FMTARGS(3);
 IMGUI_API int           ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args) IM_FMTLIST(3);
 IMGUI_API const char*   ImParseFormatFindStart(const char* format);
@@ -767,8 +787,24 @@ struct IMGUI_API ImGuiMenuColumns
     float       CalcExtraSpace(float avail_w) const;
 };
 
+// Multi-line text inputs of this size (in bytes) switch to large document mode (see ImGuiInputTextFlags_LargeDocument)
+#ifndef IM_INPUTTEXT_LARGE_DOCUMENT_THRESHOLD
+#define IM_INPUTTEXT_LARGE_DOCUMENT_THRESHOLD   (1024 * 1024)
+#endif
+
+// Start of a line in large document mode, in both wchar and UTF-8 offsets
+struct ImGuiInputTextLine
+{
+    int                     W, A;
+};
+
 // Internal state of the currently focused/edited text input box
 // For a given item ID, access with ImGui::GetInputTextState()
+// In large document mode:
+// - TextW is a gap buffer: characters are stored in [0,GapBegin) and [GapEnd,TextW.Size-1), followed by a zero terminator.
+// - TextA is updated by every edit (instead of being rebuilt from TextW every frame), so it can be displayed and applied back to the user buffer as is.
+// - Lines[] holds the start of every line. It is a gap buffer as well: entries before LinesGapBegin are offsets from the start of the text,
+//   entries from LinesGapEnd are offsets from the end of the text, so an edit only updates the entries between the previous edit and itself.
 struct IMGUI_API ImGuiInputTextState
 {
     ImGuiID                 ID;                     // widget id owning the text state
@@ -786,10 +822,15 @@ struct IMGUI_API ImGuiInputTextState
     ImGuiInputTextFlags     UserFlags;              // Temporarily set while we call user's callback
     ImGuiInputTextCallback  UserCallback;           // "
     void*                   UserCallbackData;       // "
+    bool                    IsLargeDocument;        // large document mode (see ImGuiInputTextFlags_LargeDocument)
+    bool                    IsTextEdited;           // large document mode: set on edit, cleared when applied back to the user buffer (saves comparing TextA with it every frame)
+    int                     GapBegin, GapEnd;       // large document mode: TextW gap. Always empty otherwise.
+    ImVector<ImGuiInputTextLine> Lines;             // large document mode: start of every line
+    int                     LinesGapBegin, LinesGapEnd;
 
     ImGuiInputTextState()                   { memset(this, 0, sizeof(*this)); }
-    void        ClearText()                 { CurLenW = CurLenA = 0; TextW[0] = 0; TextA[0] = 0; CursorClamp(); }
-    void        ClearFreeMemory()           { TextW.clear(); TextA.clear(); InitialTextA.clear(); }
+    void        ClearText()                 { CurLenW = CurLenA = 0; TextW[0] = 0; TextA[0] = 0; if (IsLargeDocument) BuildLargeDocument(); CursorClamp(); }
+    void        ClearFreeMemory()           { TextW.clear(); TextA.clear(); InitialTextA.clear(); Lines.clear(); }
     int         GetUndoAvailCount() const   { return Stb.undostate.undo_point; }
     int         GetRedoAvailCount() const   { return STB_TEXTEDIT_UNDOSTATECOUNT - Stb.undostate.redo_point; }
     void        OnKeyPressed(int key);      // Cannot be inline because we call in code in stb_textedit.h implementation
@@ -800,6 +841,14 @@ struct IMGUI_API ImGuiInputTextState
     bool        HasSelection() const        { return Stb.select_start != Stb.select_end; }
     void        ClearSelection()            { Stb.select_start = Stb.select_end = Stb.cursor; }
     void        SelectAll()                 { Stb.select_start = 0; Stb.cursor = Stb.select_end = CurLenW; Stb.has_preferred_x = 0; }
+
+    // Large document mode
+    void        BuildLargeDocument();       // Enter large document mode with the text in TextW[0..CurLenW]: rebuild TextA and the line index
+    ImWchar     GetCharW(int pos) const     { return TextW[pos < GapBegin ? pos : pos + GapEnd - GapBegin]; }
+    int         GetLineCount() const        { return Lines.Size - (LinesGapEnd - LinesGapBegin); }
+    ImGuiInputTextLine GetLine(int line_no) const { if (line_no < LinesGapBegin) return Lines[line_no]; const ImGuiInputTextLine& l = Lines[line_no + LinesGapEnd - LinesGapBegin]; ImGuiInputTextLine r = { CurLenW - l.W, CurLenA - l.A }; return r; }
+    int         FindLine(int pos) const;    // Line straddling character 'pos'
+    int         GetOffsetA(int pos) const;  // UTF-8 offset of character 'pos'
 };
 
 // Windows data saved in imgui.ini file
@@ -822,12 +871,22 @@ struct ImGuiSettingsHandler
     ImGuiID     TypeHash;       // == ImHashStr(TypeName)
     void*       (*ReadOpenFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, const char* name);              // Read: Called when entering into a new ini entry e.g. "[Window][Name]"
     void        (*ReadLineFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, void* entry, const char* line); // Read: Called for every line of text within an ini entry
+    void        (*ApplyAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler);                                // Read: Called after reading (in registration order). Optional.
     void        (*WriteAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* out_buf);      // Write: Output every entries into 'out_buf'
     void*       UserData;
 
     ImGuiSettingsHandler() { memset(this, 0, sizeof(*this)); }
 };
 
+// Entry of a binary .ini file (io.IniBinaryFormat): the text written by a handler for one "[Type][Name]" entry.
+struct ImGuiSettingsBinaryEntry
+{
+    ImGuiID     Key;            // == ImHashStr("[Type][Name]")
+    ImU32       Hash;           // == ImHashData(text, Size, Key). Also stored in the file as a checksum.
+    ImU32       Size;           // Size of the text
+    ImU32       Offset;         // Offset of the text in the buffer being read or written
+};
+
 // Storage for current popup stack
 struct ImGuiPopupData
 {
@@ -896,11 +955,25 @@ struct ImGuiColumns
 #define IM_DRAWLIST_ARCFAST_TESSELLATION_MULTIPLIER             1
 #endif
 
+// ImDrawList: Size in bytes of the chunks compared from one frame to the next when io.ConfigDrawListDiff is enabled.
+// Smaller chunks give tighter dirty ranges but more comparison overhead and more ranges to upload.
+#ifndef IM_DRAWLIST_DIFF_CHUNK_SIZE
+#define IM_DRAWLIST_DIFF_CHUNK_SIZE                             4096
+#endif
+
+// Eyedropper: Width and height of the framebuffer region read back around the mouse cursor, and zoom factor of the loupe displaying it.
+#define IM_EYEDROPPER_SAMPLE_SIZE                               11
+#define IM_EYEDROPPER_LOUPE_ZOOM                                8.0f
+
+// ImFontAtlas: Number of cells along each axis of the checkerboard baked in the atlas (see ImFontAtlas::TexUvCheckerboard).
+#define IM_FONT_ATLAS_CHECKERBOARD_CELLS                        8
+
 // Data shared between all ImDrawList instances
 // You may want to create your own instance of this if you want to use ImDrawList completely without ImGui. In that case, watch out for future changes to this structure.
 struct IMGUI_API ImDrawListSharedData
 {
     ImVec2          TexUvWhitePixel;            // UV of white pixel in the atlas
+    ImVec4          TexUvCheckerboard;          // UV of the checkerboard in the atlas (zero if not built, see ImFontAtlasFlags_NoCheckerboard)
     ImFont*         Font;                       // Current/default font (optional, for simplified AddText overload)
     float           FontSize;                   // Current/default font size (optional, for simplified AddText overload)
     float           CurveTessellationTol;       // Tessellation tolerance when using PathBezierCurveTo()
@@ -1011,6 +1084,165 @@ struct ImGuiPtrOrIndex
     ImGuiPtrOrIndex(int index)          { Ptr = NULL; Index = index; }
 };
 
+// Min/max pyramid over the values of a plot (ImGuiPlotFlags_CacheValues), so the min/max of any range of values costs O(log(values_count)).
+// Levels[k][i] = (min, max) of values [i << (k + IM_PLOT_CACHE_BUCKET_SHIFT), (i + 1) << (k + IM_PLOT_CACHE_BUCKET_SHIFT)), NaN excluded. Only complete buckets are stored.
+#define IM_PLOT_CACHE_BUCKET_SHIFT  4
+#define IM_PLOT_CACHE_LEVELS        (31 - IM_PLOT_CACHE_BUCKET_SHIFT)
+struct ImGuiPlotCache
+{
+    ImGuiID             ID;
+    float               (*ValuesGetter)(void* data, int idx);
+    const void*         Data;               // User data, or values array
+    int                 Stride;             // For values arrays
+    int                 ValuesCount;        // Number of values the pyramid was built from
+    int                 LastFrameActive;
+    float               LastTimeActive;
+    ImVector<ImVec2>    Levels[IM_PLOT_CACHE_LEVELS];
+
+    ImGuiPlotCache()    { ID = 0; ValuesGetter = NULL; Data = NULL; Stride = ValuesCount = 0; LastFrameActive = -1; LastTimeActive = -1.0f; }
+};
+
+// Type-ahead search of Combo() and ListBox(): typing the start of a label moves the focus to the first item with that label.
+// The labels are copied lower-cased and sorted once, then each search is a binary search on the typed prefix: O(log(items_count)).
+// Only the list being typed into has an index. It is rebuilt when the list changes, or when a combo popup opens.
+#define IM_TYPING_SELECT_TIMEOUT    1.0f    // Seconds without typing after which a new search starts
+struct ImGuiTypingSelectEntry
+{
+    const char*         Label;              // Lower-cased label, in ImGuiTypingSelectIndex::Labels
+    int                 Index;
+};
+
+struct ImGuiTypingSelectIndex
+{
+    ImGuiID             ID;                 // Window of the list (0 if the index needs rebuilding)
+    bool                (*ItemsGetter)(void* data, int idx, const char** out_text);
+    void*               Data;
+    int                 ItemsCount;
+    ImVector<char>      Labels;
+    ImVector<ImGuiTypingSelectEntry> Entries; // Sorted by label, then by index
+    char                SearchBuf[64];      // Lower-cased characters typed so far
+    int                 SearchLen;
+    double              SearchTime;         // Time of the last character typed
+
+    ImGuiTypingSelectIndex() { ID = 0; ItemsGetter = NULL; Data = NULL; ItemsCount = 0; SearchBuf[0] = 0; SearchLen = 0; SearchTime = -FLT_MAX; }
+};
+
+// Colors remembered by the color pickers: the recent colors shown by ColorPicker4(), and a palette saved in the .ini file.
+// Colors are compared by their value quantized to 8-bit per channel (ColorConvertFloat4ToU32()), which is also the precision the palette is stored with.
+#define IM_COLOR_RECENT_COUNT               16          // Recent colors shown by ColorPicker4()
+#define IM_COLOR_PALETTE_MAX_COUNT          (1 << 20)
+#define IM_COLOR_PALETTE_SETTINGS_CHUNK     4096        // Colors per .ini entry, so adding to a large palette only rewrites its last entry (see io.IniBinaryFormat)
+struct ImGuiColorPaletteSlot
+{
+    ImU32               Key;                                // Quantized color
+    int                 Index;                              // Index in ImGuiColorHistory::Palette[], -1 for an empty slot
+};
+
+// Palette entry read from the .ini file, applied once all entries are read (a binary .ini file doesn't keep the order of entries)
+struct ImGuiColorPaletteSettingsChunk
+{
+    int                 Start;                              // Index of its first color in the palette
+    int                 KeysOffset;                         // Index of its first color in ImGuiColorHistory::SettingsKeys[]
+    int                 KeysCount;
+};
+
+struct ImGuiColorHistory
+{
+    ImVec4              Recent[IM_COLOR_RECENT_COUNT];      // Most recent first, RGBA
+    ImU32               RecentKeys[IM_COLOR_RECENT_COUNT];  // Quantized Recent[]
+    int                 RecentCount;
+    ImVector<ImVec4>    Palette;                            // Quantized RGBA
+    ImVector<ImGuiColorPaletteSlot> PaletteLookup;          // Hash table (open addressing, power of two size) of Palette[], for O(1) duplicate checks. Keys are stored to avoid reading Palette[] when probing.
+    ImVector<ImGuiColorPaletteSettingsChunk> SettingsChunks;
+    ImVector<ImU32>     SettingsKeys;                       // Colors of SettingsChunks[], in reading order
+
+    ImGuiColorHistory() { RecentCount = 0; }
+};
+
+// Allocation statistics for a call-site of IM_ALLOC_FRAME()
+struct ImGuiFrameArenaCallsite
+{
+    const char*     File;
+    int             Line;
+    int             AllocCount;             // Current frame
+    size_t          AllocBytes;
+    int             AllocCountPrevFrame;
+    size_t          AllocBytesPrevFrame;
+    size_t          AllocBytesMax;          // Peak of AllocBytes over all frames
+};
+
+struct ImGuiFrameArenaBlock
+{
+    char*           Data;
+    size_t          Size;
+};
+
+// Bump allocator for transient allocations which don't outlive the frame, used by IM_ALLOC_FRAME().
+// Reset() is called by NewFrame(). If a frame needed more than one block, they are merged into a single block on Reset(),
+// so in steady state the arena serves all allocations from one block and doesn't call MemAlloc().
+// When no frame used more than half of the block for 'io.ConfigWindowsMemoryCompactTimer' seconds, the block is shrunk
+// to twice the peak usage of those frames, so a single heavy frame doesn't keep its memory alive forever.
+struct IMGUI_API ImGuiFrameArena
+{
+    ImVector<ImGuiFrameArenaBlock>      Blocks;
+    int                                 CurrentBlock;
+    size_t                              CurrentOffset;          // Offset of the next allocation in Blocks[CurrentBlock]
+    size_t                              UsedBytes;              // Current frame
+    size_t                              UsedBytesPrevFrame;
+    size_t                              UsedBytesMax;           // High-water mark
+    size_t                              UsedBytesRecentMax;     // High-water mark of the frames since LastTimeCapacityNeeded
+    float                               LastTimeCapacityNeeded; // Last time a frame used more than half of the capacity
+    ImVector<ImGuiFrameArenaCallsite>   Callsites;
+
+    ImGuiFrameArena()                   { CurrentBlock = 0; CurrentOffset = UsedBytes = UsedBytesPrevFrame = UsedBytesMax = UsedBytesRecentMax = 0; LastTimeCapacityNeeded = 0.0f; }
+    ~ImGuiFrameArena()                  { ClearFreeMemory(); }
+    void*   Alloc(size_t size, const char* file, int line);
+    void    Reset(float current_time, float compact_timer);         // compact_timer < 0.0f: never shrink
+    void    ClearFreeMemory();
+};
+
+// Subsystems for memory accounting (see IMGUI_ENABLE_MEMORY_ACCOUNTING in imconfig.h)
+// Allocations made by IM_ALLOC() are attributed to the tag of the innermost IM_MEMTAG_SCOPE(), or ImGuiMemTag_Misc.
+enum ImGuiMemTag_
+{
+    ImGuiMemTag_Misc,
+    ImGuiMemTag_Windows,
+    ImGuiMemTag_DrawLists,
+    ImGuiMemTag_FontAtlas,
+    ImGuiMemTag_Storage,
+    ImGuiMemTag_Settings,
+    ImGuiMemTag_TextEdit,
+    ImGuiMemTag_FrameArena,
+    ImGuiMemTag_COUNT
+};
+
+struct ImGuiMemTagStats
+{
+    int             AllocCount;             // Number of allocations since startup
+    int             ActiveAllocCount;
+    size_t          ActiveBytes;
+    size_t          ActiveBytesMax;         // High-water mark of ActiveBytes
+};
+
+#ifdef IMGUI_ENABLE_MEMORY_ACCOUNTING
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+extern IMGUI_API IM_THREAD_LOCAL ImGuiMemTag GImMemTag;                     // Current tag, see IM_MEMTAG_SCOPE()
+#else
+extern IMGUI_API ImGuiMemTag        GImMemTag;                              // Current tag, see IM_MEMTAG_SCOPE()
+#endif
+extern IMGUI_API ImGuiMemTagStats   GImMemTagStats[ImGuiMemTag_COUNT];      // Global, like the allocator functions: shared by all contexts. Updated atomically by MemAlloc()/MemFree().
+
+struct ImGuiMemTagScope
+{
+    ImGuiMemTag     BackupTag;
+    ImGuiMemTagScope(ImGuiMemTag tag)   { BackupTag = GImMemTag; GImMemTag = tag; }
+    ~ImGuiMemTagScope()                 { GImMemTag = BackupTag; }
+};
+#define IM_MEMTAG_SCOPE(_TAG)               ImGuiMemTagScope im_memtag_scope(_TAG)
+#else
+#define IM_MEMTAG_SCOPE(_TAG)               do { } while (0)
+#endif
+
 //-----------------------------------------------------------------------------
 // Main Dear ImGui context
 //-----------------------------------------------------------------------------
@@ -1145,6 +1377,7 @@ struct ImGuiContext
     // Render
     ImDrawData              DrawData;                           // Main ImDrawData instance to pass render information to the user
     ImDrawDataBuilder       DrawDataBuilder;
+    ImGuiFrameArena         FrameArena;                         // Transient allocations released by NewFrame(), see IM_ALLOC_FRAME()
     float                   DimBgRatio;                         // 0.0..1.0 animation when fading in a dimming background (for modal window and CTRL+TAB list)
     ImDrawList              BackgroundDrawList;                 // First draw list to be rendered.
     ImDrawList              ForegroundDrawList;                 // Last draw list to be rendered. This is where we the render software mouse cursor (if io.MouseDrawCursor is set) and most debug overlays.
@@ -1174,6 +1407,12 @@ struct ImGuiContext
     ImVector<ImGuiPtrOrIndex>       CurrentTabBarStack;
     ImVector<ImGuiShrinkWidthItem>  ShrinkWidthBuffer;
 
+    // Plots
+    ImVector<ImGuiPlotCache*>       PlotCaches;             // Plots using ImGuiPlotFlags_CacheValues. Freed after io.ConfigWindowsMemoryCompactTimer seconds without use.
+
+    // Combo, ListBox
+    ImGuiTypingSelectIndex          TypingSelect;
+
     // Widget state
     ImVec2                  LastValidMousePos;
     ImGuiInputTextState     InputTextState;
@@ -1184,6 +1423,9 @@ struct ImGuiContext
     float                   ColorEditLastSat;                   // Backup of last Saturation associated to LastColor[3], so we can restore Saturation in lossy RGB<>HSV round trips
     float                   ColorEditLastColor[3];
     ImVec4                  ColorPickerRef;                     // Initial/reference color at the time of opening the color picker.
+    ImGuiColorHistory       ColorHistory;                       // Recent colors and palette of the color pickers (see AddRecentColor(), AddPaletteColor())
+    bool                    ColorEyedropperPickPending;         // The mouse button was released over a pixel not in the eyedropper sample yet: pick it when a sample covering it arrives
+    ImVec2                  ColorEyedropperPickPos;             // Framebuffer position of that pixel
     bool                    DragCurrentAccumDirty;
     float                   DragCurrentAccum;                   // Accumulator for dragging modification. Always high-precision, not rounded by end-user precision settings
     float                   DragSpeedDefaultRatio;              // If speed == 0.0f, uses (max-min) * DragSpeedDefaultRatio
@@ -1202,6 +1444,13 @@ struct ImGuiContext
     ImGuiTextBuffer         SettingsIniData;                    // In memory .ini settings
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
+    ImVector<int>           SettingsWindowsLookup;              // Hash table (open addressing, power of two size) of offsets + 1 in SettingsWindows, for FindWindowSettings(). 0 = empty slot.
+    int                     SettingsWindowsCount;               // Number of entries in SettingsWindows
+    ImVector<ImGuiSettingsBinaryEntry>  SettingsBinaryEntries;  // Entries stored in the binary .ini file, sorted by Key (io.IniBinaryFormat)
+    ImU64                   SettingsBinaryFileSize;             // Size of the binary .ini file, including superseded records. 0 if unknown: the next save will rewrite the file.
+    ImU64                   SettingsBinaryLiveSize;             // Size the binary .ini file would have without superseded records
+    ImVector<char>          SettingsBinaryBuf;                  // Records to write
+    ImGuiSettingsWriter*    SettingsWriter;                     // Background thread writing .ini files (io.IniSaveInBackground)
 
     // Capture/Logging
     bool                    LogEnabled;
@@ -1217,6 +1466,9 @@ struct ImGuiContext
     // Debug Tools
     bool                    DebugItemPickerActive;
     ImGuiID                 DebugItemPickerBreakId;             // Will call IM_DEBUG_BREAK() when encountering this id
+    int                     MemTagAllocCount[ImGuiMemTag_COUNT];            // With IMGUI_ENABLE_MEMORY_ACCOUNTING: number of allocations made while this context was current, per tag
+    int                     MemTagAllocCountFrameStart[ImGuiMemTag_COUNT];  // Value of MemTagAllocCount[] in the last NewFrame()
+    int                     MemTagAllocCountPrevFrame[ImGuiMemTag_COUNT];   // Number of allocations made while this context was current during its previous frame
 
     // Misc
     float                   FramerateSecPerFrame[120];          // Calculate estimate of framerate for user over the last 2 seconds.
@@ -1225,6 +1477,10 @@ struct ImGuiContext
     int                     WantCaptureMouseNextFrame;          // Explicit capture via CaptureKeyboardFromApp()/CaptureMouseFromApp() sets those flags
     int                     WantCaptureKeyboardNextFrame;
     int                     WantTextInputNextFrame;
+    bool                    IdleFrameHadInputs;                 // Input events were received by NewFrame() (see GetIdleWaitTime())
+    int                     IdleCheckFrame;                     // Frame for which IdleCheckWaitTime was calculated
+    float                   IdleCheckWaitTime;
+    ImU32                   IdleDrawDataHash;                   // Hash of the draw data of frame IdleCheckFrame
     char                    TempBuffer[1024*3+1];               // Temporary text buffer
 
     ImGuiContext(ImFontAtlas* shared_font_atlas) : BackgroundDrawList(&DrawListSharedData), ForegroundDrawList(&DrawListSharedData)
@@ -1329,6 +1585,8 @@ struct ImGuiContext
         ColorEditOptions = ImGuiColorEditFlags__OptionsDefault;
         ColorEditLastHue = ColorEditLastSat = 0.0f;
         ColorEditLastColor[0] = ColorEditLastColor[1] = ColorEditLastColor[2] = FLT_MAX;
+        ColorEyedropperPickPending = false;
+        ColorEyedropperPickPos = ImVec2(0.0f, 0.0f);
         DragCurrentAccumDirty = false;
         DragCurrentAccum = 0.0f;
         DragSpeedDefaultRatio = 1.0f / 100.0f;
@@ -1339,6 +1597,9 @@ struct ImGuiContext
 
         SettingsLoaded = false;
         SettingsDirtyTimer = 0.0f;
+        SettingsWindowsCount = 0;
+        SettingsBinaryFileSize = SettingsBinaryLiveSize = 0;
+        SettingsWriter = NULL;
 
         LogEnabled = false;
         LogType = ImGuiLogType_None;
@@ -1350,11 +1611,18 @@ struct ImGuiContext
 
         DebugItemPickerActive = false;
         DebugItemPickerBreakId = 0;
+        memset(MemTagAllocCount, 0, sizeof(MemTagAllocCount));
+        memset(MemTagAllocCountFrameStart, 0, sizeof(MemTagAllocCountFrameStart));
+        memset(MemTagAllocCountPrevFrame, 0, sizeof(MemTagAllocCountPrevFrame));
 
         memset(FramerateSecPerFrame, 0, sizeof(FramerateSecPerFrame));
         FramerateSecPerFrameIdx = 0;
         FramerateSecPerFrameAccum = 0.0f;
         WantCaptureMouseNextFrame = WantCaptureKeyboardNextFrame = WantTextInputNextFrame = -1;
+        IdleFrameHadInputs = false;
+        IdleCheckFrame = -1;
+        IdleCheckWaitTime = 0.0f;
+        IdleDrawDataHash = 0;
         memset(TempBuffer, 0, sizeof(TempBuffer));
     }
 };
@@ -1661,6 +1929,7 @@ namespace ImGui
     inline    ImGuiWindow*  GetCurrentWindow()          { ImGuiContext& g = *GImGui; g.CurrentWindow->WriteAccessed = true; return g.CurrentWindow; }
     IMGUI_API ImGuiWindow*  FindWindowByID(ImGuiID id);
     IMGUI_API ImGuiWindow*  FindWindowByName(const char* name);
+    IMGUI_API bool          BeginEx(const char* name, ImGuiWindow* window, bool* p_open, ImGuiWindowFlags flags);   // 'window' == FindWindowByName(name), or NULL to look it up (and create it)
     IMGUI_API void          UpdateWindowParentAndRootLinks(ImGuiWindow* window, ImGuiWindowFlags flags, ImGuiWindow* parent_window);
     IMGUI_API ImVec2        CalcWindowExpectedSize(ImGuiWindow* window);
     IMGUI_API bool          IsWindowChildOf(ImGuiWindow* window, ImGuiWindow* potential_parent);
@@ -1699,6 +1968,7 @@ namespace ImGui
     IMGUI_API ImGuiWindowSettings*  FindWindowSettings(ImGuiID id);
     IMGUI_API ImGuiWindowSettings*  FindOrCreateWindowSettings(const char* name);
     IMGUI_API ImGuiSettingsHandler* FindSettingsHandler(const char* type_name);
+    IMGUI_API void                  LoadIniSettingsFromMemoryInPlace(char* ini_data, size_t ini_size);  // Parse without copying: writes zero-terminators in 'ini_data', which must be writable up to ini_data[ini_size] included
 
     // Scrolling
     IMGUI_API void          SetScrollX(ImGuiWindow* window, float new_scroll_x);
@@ -1743,7 +2013,7 @@ namespace ImGui
     IMGUI_API void          LogToBuffer(int auto_open_depth = -1);              // Start logging/capturing to internal buffer
 
     // Popups, Modals, Tooltips
-    IMGUI_API bool          BeginChildEx(const char* name, ImGuiID id, const ImVec2& size_arg, bool border, ImGuiWindowFlags flags);
+    IMGUI_API bool          BeginChildEx(const char* name, ImGuiID id, const ImVec2& size_arg, bool border, ImGuiWindowFlags flags, ImGuiWindowHandle* handle = NULL);
     IMGUI_API void          OpenPopupEx(ImGuiID id);
     IMGUI_API void          ClosePopupToLevel(int remaining, bool restore_focus_to_window_under_popup);
     IMGUI_API void          ClosePopupsOverWindow(ImGuiWindow* ref_window, bool restore_focus_to_window_under_popup);
@@ -1886,9 +2156,11 @@ namespace ImGui
     IMGUI_API void          ColorTooltip(const char* text, const float* col, ImGuiColorEditFlags flags);
     IMGUI_API void          ColorEditOptionsPopup(const float* col, ImGuiColorEditFlags flags);
     IMGUI_API void          ColorPickerOptionsPopup(const float* ref_col, ImGuiColorEditFlags flags);
+    IMGUI_API bool          ColorPickerEyedropper(float col[4], ImGuiColorEditFlags flags, const ImVec2& size_arg);
+    IMGUI_API void          ColorPaletteSettingsInstallHandler(ImGuiContext* context);
 
     // Plot
-    IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size);
+    IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size, ImGuiPlotFlags flags = 0);
 
     // Shade functions (write over already created vertices)
     IMGUI_API void          ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1);
@@ -1942,6 +2214,55 @@ extern void                 ImGuiTestEngineHook_Log(ImGuiContext* ctx, const cha
 #define IMGUI_TEST_ENGINE_LOG(_FMT, ...)                    do { } while (0)
 #endif
 
+// Profiler (see IMGUI_ENABLE_PROFILER in imconfig.h)
+// - Zones are recorded into a lock-free ring buffer shared by all contexts and threads. Older zones are overwritten.
+// - Use IMGUI_PROFILER_ZONE("Name") at the top of a scope. The name must be a literal/static string.
+// - Use 'Metrics->Profiler' to see timings of the last frame, or ImGui::ProfilerWriteChromeTrace() to save the ring buffer.
+#ifdef IMGUI_ENABLE_PROFILER
+#ifndef IMGUI_PROFILER_CAPACITY
+#define IMGUI_PROFILER_CAPACITY     (1 << 16)
+#endif
+
+struct ImGuiProfilerZone
+{
+    const char*         Name;
+    ImU64               StartTime;          // In nanoseconds, see ImGui::ProfilerGetTime()
+    ImU64               EndTime;
+    ImGuiContext*       Context;            // Current context when the zone ended, or NULL
+    int                 Frame;              // Context->FrameCount when the zone ended, -1 without a context. Contexts count their frames independently.
+    ImU32               ThreadId;           // Small integer assigned to each thread on its first zone
+    volatile ImU32      Sequence;           // 1 + index of the zone in the stream of recorded zones, 0 while it is being written
+};
+
+struct ImGuiProfiler
+{
+    ImGuiProfilerZone   Zones[IMGUI_PROFILER_CAPACITY];
+    volatile ImU32      WriteCount;         // Number of zones ever recorded (wraps around)
+    bool                Enabled;            // Set to false to stop recording (zones still cost a test)
+};
+
+extern IMGUI_API ImGuiProfiler GImGuiProfiler;
+
+namespace ImGui
+{
+    IMGUI_API ImU64         ProfilerGetTime();
+    IMGUI_API void          ProfilerRecordZone(const char* name, ImU64 start_time, ImU64 end_time);
+    IMGUI_API int           ProfilerCopyZones(ImVector<ImGuiProfilerZone>* out_zones, int min_frame = INT_MIN, ImGuiContext* ctx = NULL);  // Copy complete zones in recording order, return number of zones added. Only zones of 'ctx' if not NULL.
+    IMGUI_API bool          ProfilerWriteChromeTrace(const char* filename);
+}
+
+struct ImGuiProfilerScope
+{
+    const char*         Name;
+    ImU64               StartTime;
+    ImGuiProfilerScope(const char* name)    { Name = name; StartTime = GImGuiProfiler.Enabled ? ImGui::ProfilerGetTime() : 0; }
+    ~ImGuiProfilerScope()                   { if (StartTime != 0) ImGui::ProfilerRecordZone(Name, StartTime, ImGui::ProfilerGetTime()); }
+};
+#define IMGUI_PROFILER_ZONE(_NAME)          ImGuiProfilerScope im_profiler_zone(_NAME)
+#else
+#define IMGUI_PROFILER_ZONE(_NAME)          do { } while (0)
+#endif
+
 #if defined(__clang__)
 #pragma clang diagnostic pop
 #elif defined(__GNUC__)
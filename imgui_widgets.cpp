@@ -1596,6 +1596,190 @@ static bool Items_SingleStringGetter(void* data, int idx, const char** out_text)
     return true;
 }
 
+static int IMGUI_CDECL TypingSelectEntryComparer(const void* lhs, const void* rhs)
+{
+    const ImGuiTypingSelectEntry* a = (const ImGuiTypingSelectEntry*)lhs;
+    const ImGuiTypingSelectEntry* b = (const ImGuiTypingSelectEntry*)rhs;
+    if (int d = strcmp(a->Label, b->Label))
+        return d;
+    return a->Index - b->Index;
+}
+
+static void TypingSelectBuildIndex(ImGuiTypingSelectIndex* ts, ImGuiID id, bool (*items_getter)(void*, int, const char**), void* data, int items_count)
+{
+    ts->ID = id;
+    ts->ItemsGetter = items_getter;
+    ts->Data = data;
+    ts->ItemsCount = items_count;
+    ts->Labels.resize(0);
+    ts->Entries.resize(items_count);
+    for (int i = 0; i < items_count; i++)
+    {
+        const char* label;
+        if (!items_getter(data, i, &label))
+            label = "*Unknown item*";
+        const char* label_end = ImGui::FindRenderedTextEnd(label);
+        const int offset = ts->Labels.Size;
+        ts->Labels.resize(offset + (int)(label_end - label) + 1);
+        char* dst = ts->Labels.Data + offset;
+        for (const char* src = label; src < label_end; src++, dst++)
+            *dst = (*src >= 'A' && *src <= 'Z') ? *src + ('a' - 'A') : *src;
+        *dst = 0;
+        ts->Entries[i].Label = (const char*)(intptr_t)offset; // Labels[] may still be reallocated
+        ts->Entries[i].Index = i;
+    }
+    for (int i = 0; i < items_count; i++)
+        ts->Entries[i].Label = ts->Labels.Data + (intptr_t)ts->Entries[i].Label;
+    ImQsort(ts->Entries.Data, (size_t)ts->Entries.Size, sizeof(ImGuiTypingSelectEntry), TypingSelectEntryComparer);
+}
+
+// First entry with a label starting with 'prefix' (or after it if 'after' is set), entries being sorted by label
+static int TypingSelectLowerBound(const ImGuiTypingSelectIndex* ts, const char* prefix, int prefix_len, bool after)
+{
+    int lo = 0, hi = ts->Entries.Size;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi) >> 1;
+        const int d = strncmp(ts->Entries[mid].Label, prefix, (size_t)prefix_len);
+        if (d < 0 || (after && d == 0))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+// Type-ahead search of Combo() and ListBox(): add the characters typed this frame to the search, return the item to move the focus to or -1.
+static int TypingSelectUpdate(bool (*items_getter)(void*, int, const char**), void* data, int items_count)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    if (g.IO.InputQueueCharacters.Size == 0 || g.IO.KeyCtrl || g.IO.KeyAlt || g.IO.KeySuper || g.ActiveId != 0 || g.NavActivateId != 0 || !ImGui::IsWindowFocused())
+        return -1; // Keyboard navigation maps the space key to activating the focused item, which takes precedence
+
+    ImGuiTypingSelectIndex* ts = &g.TypingSelect;
+    if (ts->ID != window->ID || g.Time - ts->SearchTime > IM_TYPING_SELECT_TIMEOUT)
+        ts->SearchLen = 0;
+    bool search_changed = false;
+    for (int n = 0; n < g.IO.InputQueueCharacters.Size; n++)
+    {
+        ImWchar c = g.IO.InputQueueCharacters[n];
+        if (c < ' ' || c == 127 || (c == ' ' && ts->SearchLen == 0))
+            continue;
+        if (c >= 'A' && c <= 'Z')
+            c += 'a' - 'A';
+        char c_utf8[5];
+        const int c_len = ImTextStrToUtf8(c_utf8, IM_ARRAYSIZE(c_utf8), &c, &c + 1);
+        if (ts->SearchLen + c_len >= IM_ARRAYSIZE(ts->SearchBuf))
+            break;
+        memcpy(ts->SearchBuf + ts->SearchLen, c_utf8, (size_t)c_len);
+        ts->SearchLen += c_len;
+        search_changed = true;
+    }
+    if (!search_changed)
+        return -1;
+    ts->SearchBuf[ts->SearchLen] = 0;
+    ts->SearchTime = g.Time;
+
+    if (ts->ID != window->ID || ts->ItemsGetter != items_getter || ts->Data != data || ts->ItemsCount != items_count)
+        TypingSelectBuildIndex(ts, window->ID, items_getter, data, items_count);
+
+    const int first = TypingSelectLowerBound(ts, ts->SearchBuf, ts->SearchLen, false);
+    if (first < ts->Entries.Size && strncmp(ts->Entries[first].Label, ts->SearchBuf, (size_t)ts->SearchLen) == 0)
+        return ts->Entries[first].Index;
+
+    // Typing the same character again cycles through the items starting with it
+    for (int n = 1; n < ts->SearchLen; n++)
+        if (ts->SearchBuf[n] != ts->SearchBuf[0])
+            return -1;
+    const int cycle_first = TypingSelectLowerBound(ts, ts->SearchBuf, 1, false);
+    const int cycle_last = TypingSelectLowerBound(ts, ts->SearchBuf, 1, true);
+    if (cycle_first == cycle_last)
+        return -1;
+    return ts->Entries[cycle_first + (ts->SearchLen - 1) % (cycle_last - cycle_first)].Index;
+}
+
+static bool ItemsSelectable(int item_n, int* current_item, bool (*items_getter)(void*, int, const char**), void* data, bool focus, bool is_combo)
+{
+    const bool item_selected = (item_n == *current_item);
+    const char* item_text;
+    if (!items_getter(data, item_n, &item_text))
+        item_text = "*Unknown item*";
+
+    // Combo() and ListBox() have always pushed their item index differently, keep their IDs unchanged
+    if (is_combo)
+        ImGui::PushID((void*)(intptr_t)item_n);
+    else
+        ImGui::PushID(item_n);
+    const bool pressed = ImGui::Selectable(item_text, item_selected);
+    if (pressed)
+        *current_item = item_n;
+    if (item_selected)
+        ImGui::SetItemDefaultFocus();
+    if (focus)
+    {
+        ImGuiContext& g = *GImGui;
+        ImGuiWindow* window = g.CurrentWindow;
+        ImGui::SetFocusID(window->DC.LastItemId, window);
+        g.NavDisableHighlight = false;
+        g.NavDisableMouseHover = g.NavMousePosDirty = true;
+        ImGui::ScrollToBringRectIntoView(window, window->DC.LastItemRect);
+    }
+    ImGui::PopID();
+    return pressed;
+}
+
+// Submit the items of Combo() and ListBox(), using the clipper.
+// The item found by the type-ahead search, and the current item on the frame the list appears, are also submitted when clipped (at their position)
+// so they can be focused and scrolled to.
+// The combo popup is auto-resized to its contents: as only visible items are submitted, we measure all labels when it appears and
+// extend the contents to the widest one, so the popup width doesn't change while scrolling.
+static bool ItemsSelectableClipped(int* current_item, bool (*items_getter)(void*, int, const char**), void* data, int items_count, bool is_combo)
+{
+    ImGuiWindow* window = GImGui->CurrentWindow;
+    const int focus_item = TypingSelectUpdate(items_getter, data, items_count);
+    int forced_item = (focus_item != -1) ? focus_item : window->Appearing ? *current_item : -1;
+    if (forced_item < 0 || forced_item >= items_count)
+        forced_item = -1;
+
+    bool value_changed = false;
+    const float items_height = ImGui::GetTextLineHeightWithSpacing();
+    ImGuiListClipper clipper(items_count, items_height);
+    const float start_pos_y = clipper.StartPosY;
+    while (clipper.Step())
+        for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+        {
+            if (i == forced_item)
+                forced_item = -1;
+            value_changed |= ItemsSelectable(i, current_item, items_getter, data, i == focus_item, is_combo);
+        }
+    if (forced_item != -1)
+    {
+        ImVec2 backup_cursor_pos = window->DC.CursorPos;
+        window->DC.CursorPos.y = start_pos_y + forced_item * items_height;
+        value_changed |= ItemsSelectable(forced_item, current_item, items_getter, data, forced_item == focus_item, is_combo);
+        window->DC.CursorPos = backup_cursor_pos;
+    }
+
+    if (is_combo)
+    {
+        float* items_width = window->StateStorage.GetFloatRef(window->GetIDNoKeepAlive("#ItemsWidth"), 0.0f);
+        if (window->Appearing)
+        {
+            *items_width = 0.0f;
+            for (int i = 0; i < items_count; i++)
+            {
+                const char* item_text;
+                if (!items_getter(data, i, &item_text))
+                    item_text = "*Unknown item*";
+                *items_width = ImMax(*items_width, ImGui::CalcTextSize(item_text, NULL, true).x);
+            }
+        }
+        window->DC.CursorMaxPos.x = ImMax(window->DC.CursorMaxPos.x, window->DC.CursorStartPos.x + *items_width);
+    }
+    return value_changed;
+}
+
 // Old API, prefer using BeginCombo() nowadays if you can.
 bool ImGui::Combo(const char* label, int* current_item, bool (*items_getter)(void*, int, const char**), void* data, int items_count, int popup_max_height_in_items)
 {
@@ -1614,24 +1798,9 @@ bool ImGui::Combo(const char* label, int* current_item, bool (*items_getter)(voi
         return false;
 
     // Display items
-    // FIXME-OPT: Use clipper (but we need to disable it on the appearing frame to make sure our call to SetItemDefaultFocus() is processed)
-    bool value_changed = false;
-    for (int i = 0; i < items_count; i++)
-    {
-        PushID((void*)(intptr_t)i);
-        const bool item_selected = (i == *current_item);
-        const char* item_text;
-        if (!items_getter(data, i, &item_text))
-            item_text = "*Unknown item*";
-        if (Selectable(item_text, item_selected))
-        {
-            value_changed = true;
-            *current_item = i;
-        }
-        if (item_selected)
-            SetItemDefaultFocus();
-        PopID();
-    }
+    if (g.CurrentWindow->Appearing && g.TypingSelect.ID == g.CurrentWindow->ID)
+        g.TypingSelect.ID = 0; // Popup windows are shared by all combos
+    bool value_changed = ItemsSelectableClipped(current_item, items_getter, data, items_count, true);
 
     EndCombo();
     return value_changed;
@@ -1722,6 +1891,25 @@ const ImGuiDataTypeInfo* ImGui::DataTypeGetInfo(ImGuiDataType data_type)
 
 int ImGui::DataTypeFormatString(char* buf, int buf_size, ImGuiDataType data_type, const void* p_data, const char* format)
 {
+    // Fast path for integers with simple formats (e.g. "%d", "R:%3d", "%08X"), otherwise use vsnprintf()
+    if (data_type != ImGuiDataType_Float && data_type != ImGuiDataType_Double)
+    {
+        ImU64 v;
+        switch (data_type)
+        {
+        case ImGuiDataType_S8:  v = (ImU64)(ImS64)*(const ImS8*)p_data; break;
+        case ImGuiDataType_U8:  v = *(const ImU8*)p_data; break;
+        case ImGuiDataType_S16: v = (ImU64)(ImS64)*(const ImS16*)p_data; break;
+        case ImGuiDataType_U16: v = *(const ImU16*)p_data; break;
+        case ImGuiDataType_S32:
+        case ImGuiDataType_U32: v = *(const ImU32*)p_data; break;
+        default:                v = *(const ImU64*)p_data; break;
+        }
+        const int len = ImFormatStringInt(buf, (size_t)buf_size, format, v, data_type == ImGuiDataType_S64 || data_type == ImGuiDataType_U64);
+        if (len >= 0)
+            return len;
+    }
+
     // Signedness doesn't matter when pushing integer arguments
     if (data_type == ImGuiDataType_S32 || data_type == ImGuiDataType_U32)
         return ImFormatString(buf, buf_size, format, *(const ImU32*)p_data);
@@ -1793,6 +1981,44 @@ void ImGui::DataTypeApplyOp(ImGuiDataType data_type, int op, void* output, void*
     IM_ASSERT(0);
 }
 
+// Cheaper than sscanf() for the scan formats of integers up to 32-bit: "%d", "%u", "%x" and "%X", with optional width (e.g. "%08X").
+// Return the number of values parsed (0 or 1) like sscanf(), or -1 if the format isn't one of those.
+static int DataTypeScanInt32(const char* buf, const char* format, ImU32* out_value)
+{
+    if (format[0] != '%')
+        return -1;
+    const char* p = format + 1;
+    int width = 0;
+    while (*p >= '0' && *p <= '9' && width < 1000)
+        width = width * 10 + (*p++ - '0');
+    const char type = *p++;
+    if (*p != 0 || (type != 'd' && type != 'u' && type != 'x' && type != 'X'))
+        return -1;
+    const bool hex = (type == 'x' || type == 'X');
+
+    buf = ImStrSkipBlank(buf);
+    const char* buf_end = buf + (width > 0 ? width : INT_MAX / 2);
+    const bool negative = (buf[0] == '-');
+    if (buf < buf_end && (buf[0] == '-' || buf[0] == '+'))
+        buf++;
+    if (hex && buf[0] == '0' && (buf[1] == 'x' || buf[1] == 'X'))
+        return -1; // Leave "0x" prefixes to sscanf()
+    ImU32 v = 0;
+    const char* digits_start = buf;
+    for (; buf < buf_end; buf++)
+    {
+        const char c = *buf;
+        if (c >= '0' && c <= '9')              v = v * (hex ? 16 : 10) + (ImU32)(c - '0');
+        else if (hex && c >= 'A' && c <= 'F')  v = v * 16 + (ImU32)(c - 'A' + 10);
+        else if (hex && c >= 'a' && c <= 'f')  v = v * 16 + (ImU32)(c - 'a' + 10);
+        else break;
+    }
+    if (buf == digits_start)
+        return 0;
+    *out_value = negative ? (ImU32)0 - v : v;
+    return 1;
+}
+
 // User can input math operators (e.g. +100) to edit a numerical values.
 // NB: This is _not_ a full expression evaluator. We should probably add one and replace this dumb mess..
 bool ImGui::DataTypeApplyOpFromText(const char* buf, const char* initial_value_buf, ImGuiDataType data_type, void* p_data, const char* format)
@@ -1839,7 +2065,17 @@ bool ImGui::DataTypeApplyOpFromText(const char* buf, const char* initial_value_b
         if (op == '+')      { if (sscanf(buf, "%d", &arg1i)) *v = (int)(arg0i + arg1i); }                   // Add (use "+-" to subtract)
         else if (op == '*') { if (sscanf(buf, "%f", &arg1f)) *v = (int)(arg0i * arg1f); }                   // Multiply
         else if (op == '/') { if (sscanf(buf, "%f", &arg1f) && arg1f != 0.0f) *v = (int)(arg0i / arg1f); }  // Divide
-        else                { if (sscanf(buf, format, &arg1i) == 1) *v = arg1i; }                           // Assign constant
+        else                                                                                                // Assign constant
+        {
+            ImU32 arg1u;
+            int ret = DataTypeScanInt32(buf, format, &arg1u);
+            if (ret == -1)
+                ret = sscanf(buf, format, &arg1i);
+            else
+                arg1i = (int)arg1u;
+            if (ret == 1)
+                *v = arg1i;
+        }
     }
     else if (data_type == ImGuiDataType_Float)
     {
@@ -1874,13 +2110,28 @@ bool ImGui::DataTypeApplyOpFromText(const char* buf, const char* initial_value_b
     {
         // All other types assign constant
         // We don't bother handling support for legacy operators since they are a little too crappy. Instead we will later implement a proper expression evaluator in the future.
-        sscanf(buf, format, p_data);
+        if (data_type != ImGuiDataType_U32 || DataTypeScanInt32(buf, format, (ImU32*)p_data) == -1)
+            sscanf(buf, format, p_data);
     }
     else
     {
         // Small types need a 32-bit buffer to receive the result from scanf()
         int v32;
-        sscanf(buf, format, &v32);
+        ImU32 v32u;
+        const int ret = DataTypeScanInt32(buf, format, &v32u);
+        if (ret == -1)
+        {
+            if (sscanf(buf, format, &v32) < 1)
+                return false;
+        }
+        else if (ret == 0)
+        {
+            return false;
+        }
+        else
+        {
+            v32 = (int)v32u;
+        }
         if (data_type == ImGuiDataType_S8)
             *(ImS8*)p_data = (ImS8)ImClamp(v32, (int)IM_S8_MIN, (int)IM_S8_MAX);
         else if (data_type == ImGuiDataType_U8)
@@ -3139,15 +3390,14 @@ bool ImGui::InputTextWithHint(const char* label, const char* hint, char* buf, si
 
 static int InputTextCalcTextLenAndLineCount(const char* text_begin, const char** out_text_end)
 {
-    int line_count = 0;
+    int line_count = 1;
     const char* s = text_begin;
-    while (char c = *s++) // We are only matching for \n so we can ignore UTF-8 decoding
-        if (c == '\n')
-            line_count++;
-    s--;
-    if (s[0] != '\n' && s[0] != '\r')
+    while (const char* s_eol = strchr(s, '\n')) // We are only matching for \n so we can ignore UTF-8 decoding
+    {
         line_count++;
-    *out_text_end = s;
+        s = s_eol + 1;
+    }
+    *out_text_end = s + strlen(s);
     return line_count;
 }
 
@@ -3196,17 +3446,129 @@ static ImVec2 InputTextCalcTextSizeW(const ImWchar* text_begin, const ImWchar* t
     return text_size;
 }
 
+// Large document mode: width of characters [begin,end) of a single line, which may straddle the gap
+static float InputTextCalcLineWidthW(const ImGuiInputTextState* obj, int begin, int end)
+{
+    const ImWchar* text = obj->TextW.Data;
+    const int gap_size = obj->GapEnd - obj->GapBegin;
+    float width = 0.0f;
+    if (begin < obj->GapBegin)
+    {
+        width += InputTextCalcTextSizeW(text + begin, text + ImMin(end, obj->GapBegin)).x;
+        begin = obj->GapBegin;
+    }
+    if (begin < end)
+        width += InputTextCalcTextSizeW(text + begin + gap_size, text + end + gap_size).x;
+    return width;
+}
+
+// Large document mode: UTF-8 length of characters [begin,end)
+static int InputTextCountUtf8BytesW(const ImGuiInputTextState* obj, int begin, int end)
+{
+    const ImWchar* text = obj->TextW.Data;
+    const int gap_size = obj->GapEnd - obj->GapBegin;
+    int bytes_count = 0;
+    if (begin < obj->GapBegin)
+    {
+        bytes_count += ImTextCountUtf8BytesFromStr(text + begin, text + ImMin(end, obj->GapBegin));
+        begin = obj->GapBegin;
+    }
+    if (begin < end)
+        bytes_count += ImTextCountUtf8BytesFromStr(text + begin + gap_size, text + end + gap_size);
+    return bytes_count;
+}
+
+// Large document mode: make sure the gap of a gap buffer can hold 'count' elements
+template<typename T>
+static void InputTextGrowGap(ImVector<T>& buf, int gap_begin, int* gap_end, int count)
+{
+    if (*gap_end - gap_begin >= count)
+        return;
+    const int tail = buf.Size - *gap_end;
+    const int new_size = buf.Size + count - (*gap_end - gap_begin) + buf.Size / 2;
+    buf.reserve(new_size);
+    buf.resize(new_size);
+    memmove(buf.Data + new_size - tail, buf.Data + *gap_end, (size_t)tail * sizeof(T));
+    *gap_end = new_size - tail;
+}
+
+static void InputTextMoveGapW(ImGuiInputTextState* obj, int pos)
+{
+    ImWchar* text = obj->TextW.Data;
+    const int gap_size = obj->GapEnd - obj->GapBegin;
+    if (pos < obj->GapBegin)
+        memmove(text + pos + gap_size, text + pos, (size_t)(obj->GapBegin - pos) * sizeof(ImWchar));
+    else if (pos > obj->GapBegin)
+        memmove(text + obj->GapBegin, text + obj->GapEnd, (size_t)(pos - obj->GapBegin) * sizeof(ImWchar));
+    obj->GapBegin = pos;
+    obj->GapEnd = pos + gap_size;
+}
+
+// Entries crossing the gap switch between offsets from the start and offsets from the end of the text (either way: offset = length - offset)
+static void InputTextMoveLinesGap(ImGuiInputTextState* obj, int line_no)
+{
+    ImGuiInputTextLine* lines = obj->Lines.Data;
+    while (obj->LinesGapBegin > line_no)
+    {
+        const ImGuiInputTextLine& src = lines[--obj->LinesGapBegin];
+        ImGuiInputTextLine& dst = lines[--obj->LinesGapEnd];
+        dst.W = obj->CurLenW - src.W;
+        dst.A = obj->CurLenA - src.A;
+    }
+    while (obj->LinesGapBegin < line_no)
+    {
+        const ImGuiInputTextLine& src = lines[obj->LinesGapEnd++];
+        ImGuiInputTextLine& dst = lines[obj->LinesGapBegin++];
+        dst.W = obj->CurLenW - src.W;
+        dst.A = obj->CurLenA - src.A;
+    }
+}
+
+// Add the lines started by 'text' inserted at 'pos' (UTF-8 offset 'pos_a') to the lines gap
+static void InputTextAddLines(ImGuiInputTextState* obj, const ImWchar* text, int text_len, int pos, int pos_a)
+{
+    int new_lines = 0;
+    for (int n = 0; n < text_len; n++)
+        if (text[n] == '\n')
+            new_lines++;
+    if (new_lines == 0)
+        return;
+    InputTextGrowGap(obj->Lines, obj->LinesGapBegin, &obj->LinesGapEnd, new_lines);
+    const ImWchar* line_begin = text;
+    for (const ImWchar* s = text; s < text + text_len; s++)
+        if (*s == '\n')
+        {
+            pos_a += ImTextCountUtf8BytesFromStr(line_begin, s + 1);
+            line_begin = s + 1;
+            ImGuiInputTextLine& line = obj->Lines[obj->LinesGapBegin++];
+            line.W = pos + (int)(line_begin - text);
+            line.A = pos_a;
+        }
+}
+
 // Wrapper for stb_textedit.h to edit text (our wrapper is for: statically sized buffer, single-line, wchar characters. InputText converts between UTF-8 and wchar)
 namespace ImStb
 {
 
 static int     STB_TEXTEDIT_STRINGLEN(const STB_TEXTEDIT_STRING* obj)                             { return obj->CurLenW; }
-static ImWchar STB_TEXTEDIT_GETCHAR(const STB_TEXTEDIT_STRING* obj, int idx)                      { return obj->TextW[idx]; }
-static float   STB_TEXTEDIT_GETWIDTH(STB_TEXTEDIT_STRING* obj, int line_start_idx, int char_idx)  { ImWchar c = obj->TextW[line_start_idx + char_idx]; if (c == '\n') return STB_TEXTEDIT_GETWIDTH_NEWLINE; ImGuiContext& g = *GImGui; return g.Font->GetCharAdvance(c) * (g.FontSize / g.Font->FontSize); }
+static ImWchar STB_TEXTEDIT_GETCHAR(const STB_TEXTEDIT_STRING* obj, int idx)                      { return obj->GetCharW(idx); }
+static float   STB_TEXTEDIT_GETWIDTH(STB_TEXTEDIT_STRING* obj, int line_start_idx, int char_idx)  { ImWchar c = obj->GetCharW(line_start_idx + char_idx); if (c == '\n') return STB_TEXTEDIT_GETWIDTH_NEWLINE; ImGuiContext& g = *GImGui; return g.Font->GetCharAdvance(c) * (g.FontSize / g.Font->FontSize); }
 static int     STB_TEXTEDIT_KEYTOTEXT(int key)                                                    { return key >= 0x200000 ? 0 : key; }
 static ImWchar STB_TEXTEDIT_NEWLINE = '\n';
 static void    STB_TEXTEDIT_LAYOUTROW(StbTexteditRow* r, STB_TEXTEDIT_STRING* obj, int line_start_idx)
 {
+    if (obj->IsLargeDocument)
+    {
+        const int line_no = obj->FindLine(line_start_idx);
+        const int line_end = (line_no + 1 < obj->GetLineCount()) ? obj->GetLine(line_no + 1).W : obj->CurLenW;
+        r->x0 = 0.0f;
+        r->x1 = InputTextCalcLineWidthW(obj, line_start_idx, line_end);
+        r->baseline_y_delta = GImGui->FontSize;
+        r->ymin = 0.0f;
+        r->ymax = GImGui->FontSize;
+        r->num_chars = line_end - line_start_idx;
+        return;
+    }
     const ImWchar* text = obj->TextW.Data;
     const ImWchar* text_remaining = NULL;
     const ImVec2 size = InputTextCalcTextSizeW(text + line_start_idx, text + obj->CurLenW, &text_remaining, NULL, true);
@@ -3219,10 +3581,10 @@ static void    STB_TEXTEDIT_LAYOUTROW(StbTexteditRow* r, STB_TEXTEDIT_STRING* ob
 }
 
 static bool is_separator(unsigned int c)                                        { return ImCharIsBlankW(c) || c==',' || c==';' || c=='(' || c==')' || c=='{' || c=='}' || c=='[' || c==']' || c=='|'; }
-static int  is_word_boundary_from_right(STB_TEXTEDIT_STRING* obj, int idx)      { return idx > 0 ? (is_separator( obj->TextW[idx-1] ) && !is_separator( obj->TextW[idx] ) ) : 1; }
+static int  is_word_boundary_from_right(STB_TEXTEDIT_STRING* obj, int idx)      { return idx > 0 ? (is_separator( obj->GetCharW(idx-1) ) && !is_separator( obj->GetCharW(idx) ) ) : 1; }
 static int  STB_TEXTEDIT_MOVEWORDLEFT_IMPL(STB_TEXTEDIT_STRING* obj, int idx)   { idx--; while (idx >= 0 && !is_word_boundary_from_right(obj, idx)) idx--; return idx < 0 ? 0 : idx; }
 #ifdef __APPLE__    // FIXME: Move setting to IO structure
-static int  is_word_boundary_from_left(STB_TEXTEDIT_STRING* obj, int idx)       { return idx > 0 ? (!is_separator( obj->TextW[idx-1] ) && is_separator( obj->TextW[idx] ) ) : 1; }
+static int  is_word_boundary_from_left(STB_TEXTEDIT_STRING* obj, int idx)       { return idx > 0 ? (!is_separator( obj->GetCharW(idx-1) ) && is_separator( obj->GetCharW(idx) ) ) : 1; }
 static int  STB_TEXTEDIT_MOVEWORDRIGHT_IMPL(STB_TEXTEDIT_STRING* obj, int idx)  { idx++; int len = obj->CurLenW; while (idx < len && !is_word_boundary_from_left(obj, idx)) idx++; return idx > len ? len : idx; }
 #else
 static int  STB_TEXTEDIT_MOVEWORDRIGHT_IMPL(STB_TEXTEDIT_STRING* obj, int idx)  { idx++; int len = obj->CurLenW; while (idx < len && !is_word_boundary_from_right(obj, idx)) idx++; return idx > len ? len : idx; }
@@ -3230,8 +3592,49 @@ static int  STB_TEXTEDIT_MOVEWORDRIGHT_IMPL(STB_TEXTEDIT_STRING* obj, int idx)
 #define STB_TEXTEDIT_MOVEWORDLEFT   STB_TEXTEDIT_MOVEWORDLEFT_IMPL    // They need to be #define for stb_textedit.h
 #define STB_TEXTEDIT_MOVEWORDRIGHT  STB_TEXTEDIT_MOVEWORDRIGHT_IMPL
 
+// In large document mode, seek rows (= lines of FontSize height) through the line index instead of laying out every row above
+static void STB_TEXTEDIT_FINDROW_Y_IMPL(STB_TEXTEDIT_STRING* obj, float y, int* row_start, float* row_y)
+{
+    if (!obj->IsLargeDocument || y <= 0.0f)
+        return;
+    const int line_no = ImMin((int)(y / GImGui->FontSize), obj->GetLineCount() - 1);
+    *row_start = obj->GetLine(line_no).W;
+    *row_y = line_no * GImGui->FontSize;
+}
+static void STB_TEXTEDIT_FINDROW_CHAR_IMPL(STB_TEXTEDIT_STRING* obj, int n, int* row_start, int* prev_row_start, float* row_y)
+{
+    if (!obj->IsLargeDocument)
+        return;
+    const int line_no = obj->FindLine(n);
+    *row_start = obj->GetLine(line_no).W;
+    *prev_row_start = (line_no > 0) ? obj->GetLine(line_no - 1).W : 0;
+    *row_y = line_no * GImGui->FontSize;
+}
+#define STB_TEXTEDIT_FINDROW_Y      STB_TEXTEDIT_FINDROW_Y_IMPL
+#define STB_TEXTEDIT_FINDROW_CHAR   STB_TEXTEDIT_FINDROW_CHAR_IMPL
+
 static void STB_TEXTEDIT_DELETECHARS(STB_TEXTEDIT_STRING* obj, int pos, int n)
 {
+    if (obj->IsLargeDocument)
+    {
+        const int line_no = obj->FindLine(pos);
+        const int pos_a = obj->GetLine(line_no).A + InputTextCountUtf8BytesW(obj, obj->GetLine(line_no).W, pos);
+        const int n_a = InputTextCountUtf8BytesW(obj, pos, pos + n);
+
+        // Remove the lines started within the deleted text
+        InputTextMoveLinesGap(obj, line_no + 1);
+        while (obj->LinesGapEnd < obj->Lines.Size && obj->CurLenW - obj->Lines[obj->LinesGapEnd].W <= pos + n)
+            obj->LinesGapEnd++;
+
+        InputTextMoveGapW(obj, pos);
+        obj->GapEnd += n;
+        memmove(obj->TextA.Data + pos_a, obj->TextA.Data + pos_a + n_a, (size_t)(obj->CurLenA - pos_a - n_a + 1));
+        obj->CurLenW -= n;
+        obj->CurLenA -= n_a;
+        obj->IsTextEdited = true;
+        return;
+    }
+
     ImWchar* dst = obj->TextW.Data + pos;
 
     // We maintain our buffer length in both UTF-8 and wchar formats
@@ -3255,6 +3658,33 @@ static bool STB_TEXTEDIT_INSERTCHARS(STB_TEXTEDIT_STRING* obj, int pos, const Im
     if (!is_resizable && (new_text_len_utf8 + obj->CurLenA + 1 > obj->BufCapacityA))
         return false;
 
+    if (obj->IsLargeDocument)
+    {
+        const int line_no = obj->FindLine(pos);
+        const int pos_a = obj->GetLine(line_no).A + InputTextCountUtf8BytesW(obj, obj->GetLine(line_no).W, pos);
+        InputTextMoveLinesGap(obj, line_no + 1);
+        InputTextAddLines(obj, new_text, new_text_len, pos, pos_a);
+
+        InputTextMoveGapW(obj, pos);
+        InputTextGrowGap(obj->TextW, obj->GapBegin, &obj->GapEnd, new_text_len);
+        memcpy(obj->TextW.Data + pos, new_text, (size_t)new_text_len * sizeof(ImWchar));
+        obj->GapBegin += new_text_len;
+
+        // Convert in place, restoring the character overwritten by the zero-terminator
+        if (obj->CurLenA + new_text_len_utf8 + 1 > obj->TextA.Size)
+            obj->TextA.resize(obj->CurLenA + new_text_len_utf8 + 1);
+        char* text_a = obj->TextA.Data;
+        memmove(text_a + pos_a + new_text_len_utf8, text_a + pos_a, (size_t)(obj->CurLenA - pos_a + 1));
+        const char c = text_a[pos_a + new_text_len_utf8];
+        ImTextStrToUtf8(text_a + pos_a, new_text_len_utf8 + 1, new_text, new_text + new_text_len);
+        text_a[pos_a + new_text_len_utf8] = c;
+
+        obj->CurLenW += new_text_len;
+        obj->CurLenA += new_text_len_utf8;
+        obj->IsTextEdited = true;
+        return true;
+    }
+
     // Grow internal buffer if needed
     if (new_text_len + text_len + 1 > obj->TextW.Size)
     {
@@ -3322,6 +3752,56 @@ void ImGuiInputTextState::OnKeyPressed(int key)
     CursorAnimReset();
 }
 
+void ImGuiInputTextState::BuildLargeDocument()
+{
+    IM_ASSERT(CurLenW < TextW.Size);
+    IsLargeDocument = true;
+    GapBegin = CurLenW;
+    GapEnd = TextW.Size - 1;
+    TextW[GapEnd] = 0;
+
+    // Index lines and measure UTF-8 length in a single pass
+    ImGuiInputTextLine line = { 0, 0 };
+    Lines.resize(0);
+    Lines.push_back(line);
+    for (const ImWchar* s = TextW.Data; s < TextW.Data + CurLenW; s++)
+    {
+        const unsigned int c = (unsigned int)*s;
+        line.A += (c < 0x80) ? 1 : ImTextCountUtf8BytesFromStr(s, s + 1);
+        if (c == '\n')
+        {
+            line.W = (int)(s - TextW.Data) + 1;
+            Lines.push_back(line);
+        }
+    }
+    LinesGapBegin = LinesGapEnd = Lines.Size;
+    CurLenA = line.A;
+    TextA.resize(CurLenA + 1);
+    ImTextStrToUtf8(TextA.Data, TextA.Size, TextW.Data, TextW.Data + CurLenW);
+    TextAIsValid = true;
+}
+
+int ImGuiInputTextState::FindLine(int pos) const
+{
+    int line_min = 0;
+    int line_max = GetLineCount() - 1;
+    while (line_min < line_max)
+    {
+        const int line_mid = (line_min + line_max + 1) >> 1;
+        if (GetLine(line_mid).W <= pos)
+            line_min = line_mid;
+        else
+            line_max = line_mid - 1;
+    }
+    return line_min;
+}
+
+int ImGuiInputTextState::GetOffsetA(int pos) const
+{
+    const ImGuiInputTextLine line = GetLine(FindLine(pos));
+    return line.A + InputTextCountUtf8BytesW(this, line.W, pos);
+}
+
 ImGuiInputTextCallbackData::ImGuiInputTextCallbackData()
 {
     memset(this, 0, sizeof(*this));
@@ -3460,6 +3940,7 @@ static bool InputTextFilterCharacter(unsigned int* p_char, ImGuiInputTextFlags f
 //  doing UTF8 > U16 > UTF8 conversions on the go to easily interface with stb_textedit. Ideally should stay in UTF-8 all the time. See https://github.com/nothings/stb/issues/188)
 bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_size, const ImVec2& size_arg, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* callback_user_data)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_TextEdit);
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
         return false;
@@ -3559,12 +4040,25 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         memcpy(state->InitialTextA.Data, buf, buf_len + 1);
 
         // Start edition
-        const char* buf_end = NULL;
-        state->TextW.resize(buf_size + 1);          // wchar count <= UTF-8 count. we use +1 to make sure that .Data is always pointing to at least an empty string.
-        state->TextA.resize(0);
-        state->TextAIsValid = false;                // TextA is not valid yet (we will display buf until then)
-        state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, buf_size, buf, NULL, &buf_end);
-        state->CurLenA = (int)(buf_end - buf);      // We can't get the result from ImStrncpy() above because it is not UTF-8 aware. Here we'll cut off malformed UTF-8.
+        state->IsTextEdited = false;
+        if (is_multiline && ((flags & ImGuiInputTextFlags_LargeDocument) || buf_len >= IM_INPUTTEXT_LARGE_DOCUMENT_THRESHOLD))
+        {
+            // Large document mode: size our buffers after the text rather than after 'buf_size', and build the line index once
+            state->TextW.resize(buf_len + 1);
+            state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, state->TextW.Size, buf, buf + buf_len);
+            state->BuildLargeDocument();
+        }
+        else
+        {
+            const char* buf_end = NULL;
+            state->IsLargeDocument = false;
+            state->GapBegin = state->GapEnd = 0;
+            state->TextW.resize(buf_size + 1);          // wchar count <= UTF-8 count. we use +1 to make sure that .Data is always pointing to at least an empty string.
+            state->TextA.resize(0);
+            state->TextAIsValid = false;                // TextA is not valid yet (we will display buf until then)
+            state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, buf_size, buf, NULL, &buf_end);
+            state->CurLenA = (int)(buf_end - buf);      // We can't get the result from ImStrncpy() above because it is not UTF-8 aware. Here we'll cut off malformed UTF-8.
+        }
 
         // Preserve cursor position and undo/redo stack if we come back to same widget
         // FIXME: For non-readonly widgets we might be able to require that TextAIsValid && TextA == buf ? (untested) and discard undo stack if user buffer has changed.
@@ -3623,9 +4117,9 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     bool value_changed = false;
     bool enter_pressed = false;
 
-    // When read-only we always use the live data passed to the function
+    // When read-only we always use the live data passed to the function (except in large document mode)
     // FIXME-OPT: Because our selection/cursor code currently needs the wide text we need to convert it when active, which is not ideal :(
-    if (is_readonly && state != NULL && (render_cursor || render_selection))
+    if (is_readonly && state != NULL && (render_cursor || render_selection) && !state->IsLargeDocument)
     {
         const char* buf_end = NULL;
         state->TextW.resize(buf_size + 1);
@@ -3636,7 +4130,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     }
 
     // Select the buffer to render.
-    const bool buf_display_from_state = (render_cursor || render_selection || g.ActiveId == id) && !is_readonly && state && state->TextAIsValid;
+    const bool buf_display_from_state = (render_cursor || render_selection || g.ActiveId == id) && state && (!is_readonly || state->IsLargeDocument) && state->TextAIsValid;
     const bool is_displaying_hint = (hint != NULL && (buf_display_from_state ? state->TextA.Data : buf)[0] == 0);
 
     // Password pushes a temporary font with only a fallback glyph
@@ -3811,11 +4305,22 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             {
                 const int ib = state->HasSelection() ? ImMin(state->Stb.select_start, state->Stb.select_end) : 0;
                 const int ie = state->HasSelection() ? ImMax(state->Stb.select_start, state->Stb.select_end) : state->CurLenW;
-                const int clipboard_data_len = ImTextCountUtf8BytesFromStr(state->TextW.Data + ib, state->TextW.Data + ie) + 1;
-                char* clipboard_data = (char*)IM_ALLOC(clipboard_data_len * sizeof(char));
-                ImTextStrToUtf8(clipboard_data, clipboard_data_len, state->TextW.Data + ib, state->TextW.Data + ie);
-                SetClipboardText(clipboard_data);
-                MemFree(clipboard_data);
+                if (state->IsLargeDocument)
+                {
+                    const int ib_a = state->GetOffsetA(ib);
+                    const int ie_a = state->GetOffsetA(ie);
+                    char* clipboard_data = (char*)IM_ALLOC_FRAME((ie_a - ib_a + 1) * sizeof(char));
+                    memcpy(clipboard_data, state->TextA.Data + ib_a, (size_t)(ie_a - ib_a));
+                    clipboard_data[ie_a - ib_a] = 0;
+                    SetClipboardText(clipboard_data);
+                }
+                else
+                {
+                    const int clipboard_data_len = ImTextCountUtf8BytesFromStr(state->TextW.Data + ib, state->TextW.Data + ie) + 1;
+                    char* clipboard_data = (char*)IM_ALLOC_FRAME(clipboard_data_len * sizeof(char));
+                    ImTextStrToUtf8(clipboard_data, clipboard_data_len, state->TextW.Data + ib, state->TextW.Data + ie);
+                    SetClipboardText(clipboard_data);
+                }
             }
             if (is_cut)
             {
@@ -3831,7 +4336,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             {
                 // Filter pasted buffer
                 const int clipboard_len = (int)strlen(clipboard);
-                ImWchar* clipboard_filtered = (ImWchar*)IM_ALLOC((clipboard_len+1) * sizeof(ImWchar));
+                ImWchar* clipboard_filtered = (ImWchar*)IM_ALLOC_FRAME((clipboard_len+1) * sizeof(ImWchar));
                 int clipboard_filtered_len = 0;
                 for (const char* s = clipboard; *s; )
                 {
@@ -3849,10 +4354,16 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     stb_textedit_paste(state, &state->Stb, clipboard_filtered, clipboard_filtered_len);
                     state->CursorFollow = true;
                 }
-                MemFree(clipboard_filtered);
             }
         }
 
+        // Switch to large document mode once the text gets large (e.g. after pasting a big document)
+        if (is_multiline && !state->IsLargeDocument && state->CurLenA >= IM_INPUTTEXT_LARGE_DOCUMENT_THRESHOLD)
+        {
+            state->BuildLargeDocument();
+            state->IsTextEdited = true;
+        }
+
         // Update render selection flag after events have been handled, so selection highlight can be displayed during the same frame.
         render_selection |= state->HasSelection() && (RENDER_SELECTION_WHEN_INACTIVE || render_cursor);
     }
@@ -3871,13 +4382,15 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 // Push records into the undo stack so we can CTRL+Z the revert operation itself
                 apply_new_text = state->InitialTextA.Data;
                 apply_new_text_length = state->InitialTextA.Size - 1;
-                ImVector<ImWchar> w_text;
+                ImWchar* w_text = NULL;
+                int w_text_len = 0;
                 if (apply_new_text_length > 0)
                 {
-                    w_text.resize(ImTextCountCharsFromUtf8(apply_new_text, apply_new_text + apply_new_text_length) + 1);
-                    ImTextStrFromUtf8(w_text.Data, w_text.Size, apply_new_text, apply_new_text + apply_new_text_length);
+                    w_text_len = ImTextCountCharsFromUtf8(apply_new_text, apply_new_text + apply_new_text_length);
+                    w_text = (ImWchar*)IM_ALLOC_FRAME((w_text_len + 1) * sizeof(ImWchar));
+                    ImTextStrFromUtf8(w_text, w_text_len + 1, apply_new_text, apply_new_text + apply_new_text_length);
                 }
-                stb_textedit_replace(state, &state->Stb, w_text.Data, (apply_new_text_length > 0) ? (w_text.Size - 1) : 0);
+                stb_textedit_replace(state, &state->Stb, w_text, w_text_len);
             }
         }
 
@@ -3890,8 +4403,8 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             // Apply new value immediately - copy modified buffer back
             // Note that as soon as the input box is active, the in-widget value gets priority over any underlying modification of the input buffer
             // FIXME: We actually always render 'buf' when calling DrawList->AddText, making the comment above incorrect.
-            // FIXME-OPT: CPU waste to do this every time the widget is active, should mark dirty state from the stb_textedit callbacks.
-            if (!is_readonly)
+            // FIXME-OPT: CPU waste to do this every time the widget is active, should mark dirty state from the stb_textedit callbacks. (Large document mode does: TextA is updated by edits.)
+            if (!is_readonly && !state->IsLargeDocument)
             {
                 state->TextAIsValid = true;
                 state->TextA.resize(state->TextW.Size * 4 + 1);
@@ -3926,6 +4439,9 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
 
                 if (event_flag)
                 {
+                    if (state->IsLargeDocument)
+                        state->TextA.reserve(state->BufCapacityA); // Callback may write up to BufSize bytes
+
                     ImGuiInputTextCallbackData callback_data;
                     memset(&callback_data, 0, sizeof(ImGuiInputTextCallbackData));
                     callback_data.EventFlag = event_flag;
@@ -3940,9 +4456,10 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
 
                     // We have to convert from wchar-positions to UTF-8-positions, which can be pretty slow (an incentive to ditch the ImWchar buffer, see https://github.com/nothings/stb/issues/188)
                     ImWchar* text = state->TextW.Data;
-                    const int utf8_cursor_pos = callback_data.CursorPos = ImTextCountUtf8BytesFromStr(text, text + state->Stb.cursor);
-                    const int utf8_selection_start = callback_data.SelectionStart = ImTextCountUtf8BytesFromStr(text, text + state->Stb.select_start);
-                    const int utf8_selection_end = callback_data.SelectionEnd = ImTextCountUtf8BytesFromStr(text, text + state->Stb.select_end);
+                    const bool is_large_document = state->IsLargeDocument;
+                    const int utf8_cursor_pos = callback_data.CursorPos = is_large_document ? state->GetOffsetA(state->Stb.cursor) : ImTextCountUtf8BytesFromStr(text, text + state->Stb.cursor);
+                    const int utf8_selection_start = callback_data.SelectionStart = is_large_document ? state->GetOffsetA(state->Stb.select_start) : ImTextCountUtf8BytesFromStr(text, text + state->Stb.select_start);
+                    const int utf8_selection_end = callback_data.SelectionEnd = is_large_document ? state->GetOffsetA(state->Stb.select_end) : ImTextCountUtf8BytesFromStr(text, text + state->Stb.select_end);
 
                     // Call user code
                     callback(&callback_data);
@@ -3954,7 +4471,16 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     if (callback_data.CursorPos != utf8_cursor_pos)            { state->Stb.cursor = ImTextCountCharsFromUtf8(callback_data.Buf, callback_data.Buf + callback_data.CursorPos); state->CursorFollow = true; }
                     if (callback_data.SelectionStart != utf8_selection_start)  { state->Stb.select_start = ImTextCountCharsFromUtf8(callback_data.Buf, callback_data.Buf + callback_data.SelectionStart); }
                     if (callback_data.SelectionEnd != utf8_selection_end)      { state->Stb.select_end = ImTextCountCharsFromUtf8(callback_data.Buf, callback_data.Buf + callback_data.SelectionEnd); }
-                    if (callback_data.BufDirty)
+                    if (callback_data.BufDirty && is_large_document)
+                    {
+                        IM_ASSERT(callback_data.BufTextLen == (int)strlen(callback_data.Buf)); // You need to maintain BufTextLen if you change the text!
+                        state->TextW.resize(callback_data.BufTextLen + 1);
+                        state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, state->TextW.Size, callback_data.Buf, callback_data.Buf + callback_data.BufTextLen);
+                        state->BuildLargeDocument();
+                        state->IsTextEdited = true;
+                        state->CursorAnimReset();
+                    }
+                    else if (callback_data.BufDirty)
                     {
                         IM_ASSERT(callback_data.BufTextLen == (int)strlen(callback_data.Buf)); // You need to maintain BufTextLen if you change the text!
                         if (callback_data.BufTextLen > backup_current_text_length && is_resizable)
@@ -3967,10 +4493,11 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             }
 
             // Will copy result string if modified
-            if (!is_readonly && strcmp(state->TextA.Data, buf) != 0)
+            if (!is_readonly && (state->IsLargeDocument ? state->IsTextEdited : strcmp(state->TextA.Data, buf) != 0))
             {
                 apply_new_text = state->TextA.Data;
                 apply_new_text_length = state->CurLenA;
+                state->IsTextEdited = false;
             }
         }
 
@@ -4054,6 +4581,15 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         const ImWchar* text_begin = state->TextW.Data;
         ImVec2 cursor_offset, select_start_offset;
 
+        if (state->IsLargeDocument)
+        {
+            // Large document mode: find lines in the index and measure from their start
+            const int cursor_line_no = state->FindLine(state->Stb.cursor);
+            cursor_offset.x = InputTextCalcLineWidthW(state, state->GetLine(cursor_line_no).W, state->Stb.cursor);
+            cursor_offset.y = (cursor_line_no + 1) * g.FontSize;
+            text_size = ImVec2(inner_size.x, state->GetLineCount() * g.FontSize);
+        }
+        else
         {
             // Find lines numbers straddling 'cursor' (slot 0) and 'select_start' (slot 1) positions.
             const ImWchar* searches_input_ptr[2] = { NULL, NULL };
@@ -4136,9 +4672,39 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             state->CursorFollow = false;
         }
 
+        // Large document mode: visible lines (including the line above, as glyphs may overflow their line)
+        int visible_line_min = 0, visible_line_max = 0;
+        if (state->IsLargeDocument)
+        {
+            visible_line_min = ImClamp((int)ImFloor((draw_window->ClipRect.Min.y - draw_pos.y) / g.FontSize) - 1, 0, state->GetLineCount() - 1);
+            visible_line_max = ImClamp((int)((draw_window->ClipRect.Max.y - draw_pos.y) / g.FontSize), 0, state->GetLineCount() - 1);
+        }
+
         // Draw selection
         const ImVec2 draw_scroll = ImVec2(state->ScrollX, 0.0f);
-        if (render_selection)
+        if (render_selection && state->IsLargeDocument)
+        {
+            const int select_min = ImMin(state->Stb.select_start, state->Stb.select_end);
+            const int select_max = ImMax(state->Stb.select_start, state->Stb.select_end);
+            const int line_no_max = (select_min < select_max) ? ImMin(state->FindLine(select_max - 1), visible_line_max) : -1;
+            ImU32 bg_color = GetColorU32(ImGuiCol_TextSelectedBg, render_cursor ? 1.0f : 0.6f);
+            for (int line_no = ImMax(state->FindLine(select_min), visible_line_min); line_no <= line_no_max; line_no++)
+            {
+                const int line_begin = state->GetLine(line_no).W;
+                const int line_end = (line_no + 1 < state->GetLineCount()) ? state->GetLine(line_no + 1).W - 1 : state->CurLenW;
+                const int rect_begin = ImMax(select_min, line_begin);
+                const int rect_end = ImMin(select_max, line_end);
+                const float rect_x = InputTextCalcLineWidthW(state, line_begin, rect_begin);
+                float rect_width = InputTextCalcLineWidthW(state, rect_begin, rect_end);
+                if (rect_width <= 0.0f) rect_width = IM_FLOOR(g.Font->GetCharAdvance((ImWchar)' ') * 0.50f); // So we can see selected empty lines
+                ImVec2 rect_pos = draw_pos + ImVec2(rect_x, line_no * g.FontSize) - draw_scroll;
+                ImRect rect(rect_pos, rect_pos + ImVec2(rect_width, g.FontSize));
+                rect.ClipWith(clip_rect);
+                if (rect.Overlaps(clip_rect))
+                    draw_window->DrawList->AddRectFilled(rect.Min, rect.Max, bg_color);
+            }
+        }
+        else if (render_selection)
         {
             const ImWchar* text_selected_begin = text_begin + ImMin(state->Stb.select_start, state->Stb.select_end);
             const ImWchar* text_selected_end = text_begin + ImMax(state->Stb.select_start, state->Stb.select_end);
@@ -4174,7 +4740,13 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         }
 
         // We test for 'buf_display_max_length' as a way to avoid some pathological cases (e.g. single-line 1 MB string) which would make ImDrawList crash.
-        if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
+        if (state->IsLargeDocument && !is_displaying_hint)
+        {
+            const int text_begin_a = state->GetLine(visible_line_min).A;
+            const int text_end_a = (visible_line_max + 1 < state->GetLineCount()) ? state->GetLine(visible_line_max + 1).A : state->CurLenA;
+            draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos + ImVec2(0.0f, visible_line_min * g.FontSize) - draw_scroll, GetColorU32(ImGuiCol_Text), buf_display + text_begin_a, buf_display + text_end_a);
+        }
+        else if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
         {
             ImU32 col = GetColorU32(is_displaying_hint ? ImGuiCol_TextDisabled : ImGuiCol_Text);
             draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos - draw_scroll, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
@@ -4248,10 +4820,15 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
 // - RenderColorRectWithAlphaCheckerboard() [Internal]
 // - ColorPicker4()
 // - ColorButton()
+// - ColorPalette()
 // - SetColorEditOptions()
 // - ColorTooltip() [Internal]
 // - ColorEditOptionsPopup() [Internal]
 // - ColorPickerOptionsPopup() [Internal]
+// - ColorPickerEyedropper() [Internal]
+// - AddRecentColor(), GetRecentColors()
+// - AddPaletteColor(), FindPaletteColor(), RemovePaletteColor(), ClearPaletteColors(), GetPaletteColors()
+// - ColorPaletteSettingsInstallHandler() [Internal]
 //-------------------------------------------------------------------------
 
 bool ImGui::ColorEdit3(const char* label, float col[3], ImGuiColorEditFlags flags)
@@ -4375,24 +4952,26 @@ bool ImGui::ColorEdit4(const char* label, float col[4], ImGuiColorEditFlags flag
     }
     else if ((flags & ImGuiColorEditFlags_DisplayHex) != 0 && (flags & ImGuiColorEditFlags_NoInputs) == 0)
     {
-        // RGB Hexadecimal Input
+        // RGB Hexadecimal Input ("%02X%02X%02X%02X", formatted and parsed without printf/scanf)
+        static const char hex_digits[] = "0123456789ABCDEF";
         char buf[64];
-        if (alpha)
-            ImFormatString(buf, IM_ARRAYSIZE(buf), "%02X%02X%02X%02X", ImClamp(i[0],0,255), ImClamp(i[1],0,255), ImClamp(i[2],0,255), ImClamp(i[3],0,255));
-        else
-            ImFormatString(buf, IM_ARRAYSIZE(buf), "%02X%02X%02X", ImClamp(i[0],0,255), ImClamp(i[1],0,255), ImClamp(i[2],0,255));
+        for (int n = 0; n < components; n++)
+        {
+            const int v = ImClamp(i[n], 0, 255);
+            buf[n * 2 + 0] = hex_digits[v >> 4];
+            buf[n * 2 + 1] = hex_digits[v & 15];
+        }
+        buf[components * 2] = 0;
         SetNextItemWidth(w_inputs);
         if (InputText("##Text", buf, IM_ARRAYSIZE(buf), ImGuiInputTextFlags_CharsHexadecimal | ImGuiInputTextFlags_CharsUppercase))
         {
             value_changed = true;
-            char* p = buf;
+            const char* p = buf;
             while (*p == '#' || ImCharIsBlankA(*p))
                 p++;
             i[0] = i[1] = i[2] = i[3] = 0;
-            if (alpha)
-                sscanf(p, "%02X%02X%02X%02X", (unsigned int*)&i[0], (unsigned int*)&i[1], (unsigned int*)&i[2], (unsigned int*)&i[3]); // Treat at unsigned (%X is unsigned)
-            else
-                sscanf(p, "%02X%02X%02X", (unsigned int*)&i[0], (unsigned int*)&i[1], (unsigned int*)&i[2]);
+            for (int n = 0; n < components && p != NULL; n++)
+                p = ImStrParseHex(p, 2, (unsigned int*)&i[n]); // Treat as unsigned (like %X)
         }
         if (!(flags & ImGuiColorEditFlags_NoOptions))
             OpenPopupOnItemClick("context");
@@ -4710,6 +5289,24 @@ bool ImGui::ColorPicker4(const char* label, float col[4], ImGuiColorEditFlags fl
                 value_changed = true;
             }
         }
+        if (!(flags & ImGuiColorEditFlags_NoEyedropper) && (io.BackendFlags & ImGuiBackendFlags_RendererHasFramebufferSampling))
+            if (ColorPickerEyedropper(col, flags, ImVec2(square_sz * 3, 0.0f)))
+                value_changed = true;
+        if (!(flags & ImGuiColorEditFlags_NoRecentColors) && g.ColorHistory.RecentCount > 0)
+        {
+            // Recent colors, 4 per row under the previews. They are stored in RGB.
+            Text("Recent");
+            const float recent_sz = ImMax(1.0f, (square_sz * 3 - style.ItemInnerSpacing.x * 3) / 4);
+            int recent_index = -1;
+            if (ColorPalette("##recent", &recent_index, g.ColorHistory.Recent, g.ColorHistory.RecentCount, flags & (ImGuiColorEditFlags_NoAlpha | ImGuiColorEditFlags_AlphaPreview | ImGuiColorEditFlags_AlphaPreviewHalf | ImGuiColorEditFlags_NoTooltip), ImVec2(recent_sz, recent_sz), 4))
+            {
+                ImVec4 recent_col = g.ColorHistory.Recent[recent_index];
+                if (flags & ImGuiColorEditFlags_InputHSV)
+                    ColorConvertRGBtoHSV(recent_col.x, recent_col.y, recent_col.z, recent_col.x, recent_col.y, recent_col.z);
+                memcpy(col, &recent_col.x, components * sizeof(float));
+                value_changed = true;
+            }
+        }
         PopItemFlag();
         EndGroup();
     }
@@ -4892,6 +5489,15 @@ bool ImGui::ColorPicker4(const char* label, float col[4], ImGuiColorEditFlags fl
     if (value_changed)
         MarkItemEdited(window->DC.LastItemId);
 
+    // Remember the color once the user is done editing it
+    if (!(flags & ImGuiColorEditFlags_NoRecentColors) && IsItemDeactivatedAfterEdit())
+    {
+        ImVec4 col_rgb(col[0], col[1], col[2], (flags & ImGuiColorEditFlags_NoAlpha) ? 1.0f : col[3]);
+        if (flags & ImGuiColorEditFlags_InputHSV)
+            ColorConvertHSVtoRGB(col_rgb.x, col_rgb.y, col_rgb.z, col_rgb.x, col_rgb.y, col_rgb.z);
+        AddRecentColor(col_rgb);
+    }
+
     PopID();
 
     return value_changed;
@@ -4984,40 +5590,193 @@ bool ImGui::ColorButton(const char* desc_id, const ImVec4& col, ImGuiColorEditFl
     return pressed;
 }
 
-// Initialize/override default color options
-void ImGui::SetColorEditOptions(ImGuiColorEditFlags flags)
+// Return the index of the swatch under 'pos', or -1 when over the spacing between swatches or outside of the grid.
+static int ColorPaletteHitTest(const ImRect& bb, const ImVec2& pos, const ImVec2& swatch_size, const ImVec2& step, int columns, int colors_count)
 {
-    ImGuiContext& g = *GImGui;
-    if ((flags & ImGuiColorEditFlags__DisplayMask) == 0)
-        flags |= ImGuiColorEditFlags__OptionsDefault & ImGuiColorEditFlags__DisplayMask;
-    if ((flags & ImGuiColorEditFlags__DataTypeMask) == 0)
-        flags |= ImGuiColorEditFlags__OptionsDefault & ImGuiColorEditFlags__DataTypeMask;
-    if ((flags & ImGuiColorEditFlags__PickerMask) == 0)
-        flags |= ImGuiColorEditFlags__OptionsDefault & ImGuiColorEditFlags__PickerMask;
-    if ((flags & ImGuiColorEditFlags__InputMask) == 0)
-        flags |= ImGuiColorEditFlags__OptionsDefault & ImGuiColorEditFlags__InputMask;
-    IM_ASSERT(ImIsPowerOfTwo(flags & ImGuiColorEditFlags__DisplayMask));    // Check only 1 option is selected
-    IM_ASSERT(ImIsPowerOfTwo(flags & ImGuiColorEditFlags__DataTypeMask));   // Check only 1 option is selected
-    IM_ASSERT(ImIsPowerOfTwo(flags & ImGuiColorEditFlags__PickerMask));     // Check only 1 option is selected
-    IM_ASSERT(ImIsPowerOfTwo(flags & ImGuiColorEditFlags__InputMask));      // Check only 1 option is selected
-    g.ColorEditOptions = flags;
+    const ImVec2 rel = pos - bb.Min;
+    if (rel.x < 0.0f || rel.y < 0.0f)
+        return -1;
+    const int column = (int)(rel.x / step.x);
+    const int row = (int)(rel.y / step.y);
+    if (column >= columns || rel.x - column * step.x >= swatch_size.x || rel.y - row * step.y >= swatch_size.y)
+        return -1;
+    const int index = row * columns + column;
+    return (index < colors_count) ? index : -1;
 }
 
-// Note: only access 3 floats if ImGuiColorEditFlags_NoAlpha flag is set.
-void ImGui::ColorTooltip(const char* text, const float* col, ImGuiColorEditFlags flags)
+// A grid of little colored squares. Return true when a swatch is clicked, *current_index is then set to its index.
+// Cheaper than submitting one ColorButton() per color, which matters for palettes of thousands of colors:
+// - The grid is submitted as a single item: one ItemAdd() and hover test, the hovered swatch is computed from the mouse position.
+//   As a result keyboard/gamepad navigation treats the whole grid as one item.
+// - Only the visible swatches are rendered, each row with a single PrimReserve() call.
+// - Translucent swatches (with ImGuiColorEditFlags_AlphaPreview) are rendered with 2 quads (light background + the checkerboard baked in the font atlas)
+//   instead of one rectangle per checker cell. Swatches have no border nor rounding, they are separated by style.ItemInnerSpacing.
+// Note that 'colors' may be encoded in HSV if ImGuiColorEditFlags_InputHSV is set.
+bool ImGui::ColorPalette(const char* str_id, int* current_index, const ImVec4* colors, int colors_count, ImGuiColorEditFlags flags, ImVec2 swatch_size, int columns)
 {
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+
     ImGuiContext& g = *GImGui;
+    const ImGuiStyle& style = g.Style;
+    const ImGuiID id = window->GetID(str_id);
+    const float default_size = GetFrameHeight();
+    if (swatch_size.x <= 0.0f)
+        swatch_size.x = default_size;
+    if (swatch_size.y <= 0.0f)
+        swatch_size.y = default_size;
+    const ImVec2 spacing = style.ItemInnerSpacing;
+    const ImVec2 step = swatch_size + spacing;
+    if (columns <= 0)
+        columns = ImMax(1, (int)((GetContentRegionAvail().x + spacing.x) / step.x));
+    const int rows = (colors_count + columns - 1) / columns;
+    const ImVec2 grid_size(ImMin(columns, colors_count) * step.x - spacing.x, rows * step.y - spacing.y);
+    const ImRect bb(window->DC.CursorPos, window->DC.CursorPos + ImMax(grid_size, ImVec2(0.0f, 0.0f)));
+    ItemSize(bb);
+    if (!ItemAdd(bb, id))
+        return false;
 
-    BeginTooltipEx(0, ImGuiTooltipFlags_OverridePreviousTooltip);
-    const char* text_end = text ? FindRenderedTextEnd(text, NULL) : text;
-    if (text_end > text)
-    {
-        TextEx(text, text_end);
-        Separator();
-    }
+    // Single hit test for the whole grid
+    bool hovered, held;
+    bool pressed = ButtonBehavior(bb, id, &hovered, &held);
+    const int hovered_index = hovered ? ColorPaletteHitTest(bb, g.IO.MousePos, swatch_size, step, columns, colors_count) : -1;
+    const int clicked_index = (pressed || g.ActiveId == id) ? ColorPaletteHitTest(bb, bb.Min + g.ActiveIdClickOffset, swatch_size, step, columns, colors_count) : -1;
+    if (pressed && (g.NavActivateId == id || hovered_index < 0 || hovered_index != clicked_index))
+        pressed = false; // Released over another swatch, or activated with navigation: there is no swatch to pick from.
+    if (pressed && current_index)
+        *current_index = hovered_index;
 
-    ImVec2 sz(g.FontSize * 3 + g.Style.FramePadding.y * 2, g.FontSize * 3 + g.Style.FramePadding.y * 2);
-    ImVec4 cf(col[0], col[1], col[2], (flags & ImGuiColorEditFlags_NoAlpha) ? 1.0f : col[3]);
+    if (flags & ImGuiColorEditFlags_NoAlpha)
+        flags &= ~(ImGuiColorEditFlags_AlphaPreview | ImGuiColorEditFlags_AlphaPreviewHalf);
+
+    // Visible range of swatches
+    const ImRect& clip_rect = window->ClipRect;
+    const int row_min = ImMax((int)((clip_rect.Min.y - bb.Min.y) / step.y), 0);
+    const int row_max = ImMin((int)((clip_rect.Max.y - bb.Min.y) / step.y) + 1, rows);
+    const int column_min = ImMax((int)((clip_rect.Min.x - bb.Min.x) / step.x), 0);
+    const int column_max = ImMin((int)((clip_rect.Max.x - bb.Min.x) / step.x) + 1, columns);
+
+    // Use the atlas checkerboard when the swatch fits in it, with the checker origin at the top-left of each swatch (same as ColorButton)
+    ImDrawList* draw_list = window->DrawList;
+    const float grid_step = ImMin(swatch_size.x, swatch_size.y) / 2.99f;
+    const ImVec4& uv_checker = g.DrawListSharedData.TexUvCheckerboard;
+    const bool use_checker_tex = (uv_checker.z > uv_checker.x) && ImMax(swatch_size.x, swatch_size.y) <= grid_step * IM_FONT_ATLAS_CHECKERBOARD_CELLS;
+    const ImVec2 uv_checker_min(uv_checker.x, uv_checker.y);
+    const ImVec2 uv_checker_swatch_size((uv_checker.z - uv_checker.x) * swatch_size.x / (grid_step * IM_FONT_ATLAS_CHECKERBOARD_CELLS), (uv_checker.w - uv_checker.y) * swatch_size.y / (grid_step * IM_FONT_ATLAS_CHECKERBOARD_CELLS));
+
+    for (int row = row_min; row < row_max; row++)
+    {
+        const int index_min = row * columns + column_min;
+        const int index_max = ImMin(row * columns + column_max, colors_count);
+        if (index_min >= index_max)
+            break;
+        if (use_checker_tex)
+            draw_list->PrimReserve((index_max - index_min) * 12, (index_max - index_min) * 8);
+        int unused_quads = 0;
+        ImVec2 p_min(bb.Min.x + column_min * step.x, bb.Min.y + row * step.y);
+        for (int index = index_min; index < index_max; index++, p_min.x += step.x)
+        {
+            ImVec4 col_rgb = colors[index];
+            if (flags & ImGuiColorEditFlags_InputHSV)
+                ColorConvertHSVtoRGB(col_rgb.x, col_rgb.y, col_rgb.z, col_rgb.x, col_rgb.y, col_rgb.z);
+            if (!(flags & (ImGuiColorEditFlags_AlphaPreview | ImGuiColorEditFlags_AlphaPreviewHalf)))
+                col_rgb.w = 1.0f; // Because GetColorU32() multiplies by the global style Alpha and we don't want to display a checkerboard if the source code had no alpha
+            const ImVec2 p_max = p_min + swatch_size;
+            const ImU32 col = GetColorU32(col_rgb);
+            const bool translucent = col_rgb.w < 1.0f && ((col & IM_COL32_A_MASK) >> IM_COL32_A_SHIFT) < 0xFF;
+            if (!use_checker_tex)
+            {
+                if (translucent)
+                    RenderColorRectWithAlphaCheckerboard(draw_list, p_min, p_max, col, grid_step, ImVec2(0.0f, 0.0f));
+                else
+                    draw_list->AddRectFilled(p_min, p_max, col);
+            }
+            else if (translucent)
+            {
+                draw_list->PrimRect(p_min, p_max, GetColorU32(ImAlphaBlendColors(IM_COL32(204, 204, 204, 255), col)));
+                draw_list->PrimRectUV(p_min, p_max, uv_checker_min, uv_checker_min + uv_checker_swatch_size, GetColorU32(ImAlphaBlendColors(IM_COL32(128, 128, 128, 255), col)));
+            }
+            else
+            {
+                draw_list->PrimRect(p_min, p_max, col);
+                unused_quads++;
+            }
+        }
+        if (unused_quads > 0)
+            draw_list->PrimUnreserve(unused_quads * 6, unused_quads * 4);
+    }
+
+    // Highlight the selected and hovered swatches
+    if (current_index && *current_index >= 0 && *current_index < colors_count)
+    {
+        const ImVec2 p_min(bb.Min.x + (*current_index % columns) * step.x, bb.Min.y + (*current_index / columns) * step.y);
+        draw_list->AddRect(p_min - ImVec2(1.0f, 1.0f), p_min + swatch_size + ImVec2(1.0f, 1.0f), GetColorU32(ImGuiCol_Text), 0.0f, ImDrawCornerFlags_All, 2.0f);
+    }
+    if (hovered_index >= 0)
+    {
+        const ImVec2 p_min(bb.Min.x + (hovered_index % columns) * step.x, bb.Min.y + (hovered_index / columns) * step.y);
+        draw_list->AddRect(p_min, p_min + swatch_size, GetColorU32(ImGuiCol_Text));
+    }
+    RenderNavHighlight(bb, id);
+
+    // Drag and Drop Source, dragging the swatch which was clicked
+    if (clicked_index >= 0 && g.ActiveId == id && !(flags & ImGuiColorEditFlags_NoDragDrop) && BeginDragDropSource())
+    {
+        ImVec4 col_rgb = colors[clicked_index];
+        if (flags & ImGuiColorEditFlags_InputHSV)
+            ColorConvertHSVtoRGB(col_rgb.x, col_rgb.y, col_rgb.z, col_rgb.x, col_rgb.y, col_rgb.z);
+        if (flags & ImGuiColorEditFlags_NoAlpha)
+            SetDragDropPayload(IMGUI_PAYLOAD_TYPE_COLOR_3F, &col_rgb, sizeof(float) * 3, ImGuiCond_Once);
+        else
+            SetDragDropPayload(IMGUI_PAYLOAD_TYPE_COLOR_4F, &col_rgb, sizeof(float) * 4, ImGuiCond_Once);
+        ColorButton("##preview", colors[clicked_index], flags);
+        SameLine();
+        TextEx("Color");
+        EndDragDropSource();
+    }
+
+    // Tooltip
+    if (!(flags & ImGuiColorEditFlags_NoTooltip) && hovered_index >= 0)
+        ColorTooltip(NULL, &colors[hovered_index].x, flags & (ImGuiColorEditFlags__InputMask | ImGuiColorEditFlags_NoAlpha | ImGuiColorEditFlags_AlphaPreview | ImGuiColorEditFlags_AlphaPreviewHalf));
+
+    return pressed;
+}
+
+// Initialize/override default color options
+void ImGui::SetColorEditOptions(ImGuiColorEditFlags flags)
+{
+    ImGuiContext& g = *GImGui;
+    if ((flags & ImGuiColorEditFlags__DisplayMask) == 0)
+        flags |= ImGuiColorEditFlags__OptionsDefault & ImGuiColorEditFlags__DisplayMask;
+    if ((flags & ImGuiColorEditFlags__DataTypeMask) == 0)
+        flags |= ImGuiColorEditFlags__OptionsDefault & ImGuiColorEditFlags__DataTypeMask;
+    if ((flags & ImGuiColorEditFlags__PickerMask) == 0)
+        flags |= ImGuiColorEditFlags__OptionsDefault & ImGuiColorEditFlags__PickerMask;
+    if ((flags & ImGuiColorEditFlags__InputMask) == 0)
+        flags |= ImGuiColorEditFlags__OptionsDefault & ImGuiColorEditFlags__InputMask;
+    IM_ASSERT(ImIsPowerOfTwo(flags & ImGuiColorEditFlags__DisplayMask));    // Check only 1 option is selected
+    IM_ASSERT(ImIsPowerOfTwo(flags & ImGuiColorEditFlags__DataTypeMask));   // Check only 1 option is selected
+    IM_ASSERT(ImIsPowerOfTwo(flags & ImGuiColorEditFlags__PickerMask));     // Check only 1 option is selected
+    IM_ASSERT(ImIsPowerOfTwo(flags & ImGuiColorEditFlags__InputMask));      // Check only 1 option is selected
+    g.ColorEditOptions = flags;
+}
+
+// Note: only access 3 floats if ImGuiColorEditFlags_NoAlpha flag is set.
+void ImGui::ColorTooltip(const char* text, const float* col, ImGuiColorEditFlags flags)
+{
+    ImGuiContext& g = *GImGui;
+
+    BeginTooltipEx(0, ImGuiTooltipFlags_OverridePreviousTooltip);
+    const char* text_end = text ? FindRenderedTextEnd(text, NULL) : text;
+    if (text_end > text)
+    {
+        TextEx(text, text_end);
+        Separator();
+    }
+
+    ImVec2 sz(g.FontSize * 3 + g.Style.FramePadding.y * 2, g.FontSize * 3 + g.Style.FramePadding.y * 2);
+    ImVec4 cf(col[0], col[1], col[2], (flags & ImGuiColorEditFlags_NoAlpha) ? 1.0f : col[3]);
     int cr = IM_F32_TO_INT8_SAT(col[0]), cg = IM_F32_TO_INT8_SAT(col[1]), cb = IM_F32_TO_INT8_SAT(col[2]), ca = (flags & ImGuiColorEditFlags_NoAlpha) ? 255 : IM_F32_TO_INT8_SAT(col[3]);
     ColorButton("##preview", cf, (flags & (ImGuiColorEditFlags__InputMask | ImGuiColorEditFlags_NoAlpha | ImGuiColorEditFlags_AlphaPreview | ImGuiColorEditFlags_AlphaPreviewHalf)) | ImGuiColorEditFlags_NoTooltip, sz);
     SameLine();
@@ -5127,6 +5886,339 @@ void ImGui::ColorPickerOptionsPopup(const float* ref_col, ImGuiColorEditFlags fl
     EndPopup();
 }
 
+// Button to pick a color from the screen. Once clicked, the color under the mouse cursor is displayed in a magnified loupe
+// until the left button is released again (picking the color) or right button/Escape are pressed (canceling).
+// The pixels come from the renderer back-end (see io.WantSampleFramebuffer, io.AddFramebufferSample()), typically a few frames late:
+// we only pick a pixel present in the last sample. If the button is released before it arrives, the eyedropper stays active and keeps
+// requesting the region around the release position until a sample covering it arrives.
+// The eyedropper holds ActiveId while picking, so clicking outside of the picker doesn't close its popup or interact with other items.
+// Only the RGB components of 'col' are written (as HSV with ImGuiColorEditFlags_InputHSV), alpha is left untouched.
+bool ImGui::ColorPickerEyedropper(float col[4], ImGuiColorEditFlags flags, const ImVec2& size_arg)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    ImGuiIO& io = g.IO;
+    const ImGuiID id = window->GetID("#EYEDROPPER");
+    bool picking = (g.ActiveId == id);
+    if (ButtonEx(picking ? "Picking...###eyedropper" : "Pick###eyedropper", size_arg) && !picking)
+    {
+        SetActiveID(id, window);
+        io.FramebufferSamplePixels.resize(0);
+        g.ColorEyedropperPickPending = false;
+        picking = true;
+    }
+    if (!picking)
+        return false;
+    KeepAliveID(id);
+
+    // Request pixels around the target for the next frames: the mouse, or the release position while a pick is pending.
+    // Nothing to request while the mouse position is invalid (e.g. outside of the OS window).
+    const int size = IM_EYEDROPPER_SAMPLE_SIZE;
+    const bool has_target = g.ColorEyedropperPickPending || IsMousePosValid();
+    const ImVec2 target_fb_pos = g.ColorEyedropperPickPending ? g.ColorEyedropperPickPos : has_target ? ImFloor(ImVec2(io.MousePos.x * io.DisplayFramebufferScale.x, io.MousePos.y * io.DisplayFramebufferScale.y)) : ImVec2(0.0f, 0.0f);
+    if (has_target)
+    {
+        io.WantSampleFramebuffer = true;
+        io.SampleFramebufferSize = size;
+        io.SampleFramebufferPos = ImVec2(target_fb_pos.x - (float)(size / 2), target_fb_pos.y - (float)(size / 2));
+    }
+
+    // Target pixel in the last sample. When the mouse moved since that sample was requested, it may not be covered yet.
+    const bool has_sample = (io.FramebufferSamplePixels.Size == size * size);
+    const ImRect sample_rect(io.FramebufferSamplePos, io.FramebufferSamplePos + io.FramebufferSampleSize);
+    const bool target_in_sample = has_target && has_sample && target_fb_pos.x >= sample_rect.Min.x && target_fb_pos.y >= sample_rect.Min.y && target_fb_pos.x < sample_rect.Max.x && target_fb_pos.y < sample_rect.Max.y;
+    int target_column = 0, target_row = 0;
+    ImU32 sampled_col = 0;
+    if (target_in_sample)
+    {
+        target_column = (int)(target_fb_pos.x - sample_rect.Min.x);
+        target_row = (int)(target_fb_pos.y - sample_rect.Min.y);
+        sampled_col = io.FramebufferSamplePixels[target_row * size + target_column] | IM_COL32_A_MASK;
+    }
+
+    // Loupe
+    BeginTooltipEx(0, ImGuiTooltipFlags_OverridePreviousTooltip);
+    if (has_sample)
+    {
+        const float zoom = IM_EYEDROPPER_LOUPE_ZOOM;
+        ImDrawList* draw_list = GetWindowDrawList();
+        const ImVec2 loupe_pos = GetCursorScreenPos();
+        Dummy(ImVec2(size * zoom, size * zoom));
+        draw_list->PrimReserve(size * size * 6, size * size * 4);
+        for (int row = 0; row < size; row++)
+            for (int column = 0; column < size; column++)
+            {
+                const ImVec2 p_min(loupe_pos.x + column * zoom, loupe_pos.y + row * zoom);
+                draw_list->PrimRect(p_min, ImVec2(p_min.x + zoom, p_min.y + zoom), io.FramebufferSamplePixels[row * size + column] | IM_COL32_A_MASK);
+            }
+        if (target_in_sample)
+        {
+            const ImVec2 cursor_min(loupe_pos.x + target_column * zoom, loupe_pos.y + target_row * zoom);
+            draw_list->AddRect(ImVec2(cursor_min.x - 1.0f, cursor_min.y - 1.0f), ImVec2(cursor_min.x + zoom + 1.0f, cursor_min.y + zoom + 1.0f), IM_COL32_BLACK);
+            draw_list->AddRect(cursor_min, ImVec2(cursor_min.x + zoom, cursor_min.y + zoom), IM_COL32_WHITE);
+        }
+    }
+    if (target_in_sample)
+    {
+        ColorButton("##sampled", ColorConvertU32ToFloat4(sampled_col), ImGuiColorEditFlags_NoTooltip | ImGuiColorEditFlags_NoDragDrop);
+        SameLine();
+        Text("#%02X%02X%02X", (sampled_col >> IM_COL32_R_SHIFT) & 0xFF, (sampled_col >> IM_COL32_G_SHIFT) & 0xFF, (sampled_col >> IM_COL32_B_SHIFT) & 0xFF);
+    }
+    else
+    {
+        TextUnformatted("Reading framebuffer...");
+    }
+    EndTooltip();
+
+    // Pick on release (not on press: the release would otherwise reach items submitted after us) or cancel.
+    // A release over a pixel we don't have yet is remembered, unless that pixel is outside of the framebuffer (never read back).
+    bool pick = false;
+    if (IsMouseReleased(1) || IsKeyPressedMap(ImGuiKey_Escape))
+    {
+        g.ColorEyedropperPickPending = false;
+        ClearActiveID();
+    }
+    else if (g.ColorEyedropperPickPending)
+    {
+        pick = target_in_sample;
+    }
+    else if (!g.ActiveIdIsJustActivated && IsMouseReleased(0))
+    {
+        const ImVec2 fb_size(io.DisplaySize.x * io.DisplayFramebufferScale.x, io.DisplaySize.y * io.DisplayFramebufferScale.y);
+        if (target_in_sample)
+            pick = true;
+        else if (has_target && target_fb_pos.x >= 0.0f && target_fb_pos.y >= 0.0f && target_fb_pos.x < fb_size.x && target_fb_pos.y < fb_size.y)
+        {
+            g.ColorEyedropperPickPending = true;
+            g.ColorEyedropperPickPos = target_fb_pos;
+        }
+        else
+        {
+            ClearActiveID();
+        }
+    }
+    if (!pick)
+        return false;
+
+    const ImVec4 sampled_col_v4 = ColorConvertU32ToFloat4(sampled_col);
+    col[0] = sampled_col_v4.x;
+    col[1] = sampled_col_v4.y;
+    col[2] = sampled_col_v4.z;
+    if (flags & ImGuiColorEditFlags_InputHSV)
+        ColorConvertRGBtoHSV(col[0], col[1], col[2], col[0], col[1], col[2]);
+    g.ColorEyedropperPickPending = false;
+    ClearActiveID();
+    return true;
+}
+
+// Recent colors: a short list kept in most recently used order, where we can afford a linear search of the quantized keys.
+void ImGui::AddRecentColor(const ImVec4& col)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiColorHistory& history = g.ColorHistory;
+    const ImU32 key = ColorConvertFloat4ToU32(col);
+    int n = 0;
+    while (n < history.RecentCount && history.RecentKeys[n] != key)
+        n++;
+    if (n == history.RecentCount)
+        n = (history.RecentCount < IM_COLOR_RECENT_COUNT) ? history.RecentCount++ : IM_COLOR_RECENT_COUNT - 1; // Drop the oldest one when full
+
+    // Move to the front
+    memmove(&history.Recent[1], &history.Recent[0], (size_t)n * sizeof(history.Recent[0]));
+    memmove(&history.RecentKeys[1], &history.RecentKeys[0], (size_t)n * sizeof(history.RecentKeys[0]));
+    history.Recent[0] = col;
+    history.RecentKeys[0] = key;
+}
+
+const ImVec4* ImGui::GetRecentColors(int* out_count)
+{
+    ImGuiContext& g = *GImGui;
+    *out_count = g.ColorHistory.RecentCount;
+    return g.ColorHistory.Recent;
+}
+
+// Palette: up to IM_COLOR_PALETTE_MAX_COUNT colors, checked for duplicates with a hash table of their quantized value.
+static inline int ColorPaletteLookupSlot(ImU32 key, int mask)
+{
+    ImU32 h = key * 0x9E3779B1u; // Scramble: similar colors differ in a few bits only
+    return (int)((h ^ (h >> 15)) & (ImU32)mask);
+}
+
+// Return the slot holding 'key', or the empty slot where it would be inserted
+static int ColorPaletteLookupFind(const ImGuiColorHistory& history, ImU32 key)
+{
+    const int mask = history.PaletteLookup.Size - 1;
+    int slot = ColorPaletteLookupSlot(key, mask);
+    while (history.PaletteLookup.Data[slot].Index >= 0 && history.PaletteLookup.Data[slot].Key != key)
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+// Size the table for 'count' colors with a maximum load factor of 1/2
+static void ColorPaletteLookupRebuild(ImGuiColorHistory& history, int count)
+{
+    int size = 64;
+    while (size < count * 2)
+        size *= 2;
+    history.PaletteLookup.resize(size);
+    memset(history.PaletteLookup.Data, 0xFF, (size_t)history.PaletteLookup.size_in_bytes());
+    for (int n = 0; n < history.Palette.Size; n++)
+    {
+        const ImU32 key = ImGui::ColorConvertFloat4ToU32(history.Palette.Data[n]);
+        ImGuiColorPaletteSlot& slot = history.PaletteLookup.Data[ColorPaletteLookupFind(history, key)];
+        slot.Key = key;
+        slot.Index = n;
+    }
+}
+
+static bool ColorPaletteAdd(ImGuiColorHistory& history, ImU32 key)
+{
+    if (history.Palette.Size >= IM_COLOR_PALETTE_MAX_COUNT)
+        return false;
+    if ((history.Palette.Size + 1) * 2 > history.PaletteLookup.Size)
+        ColorPaletteLookupRebuild(history, history.Palette.Size + 1);
+    ImGuiColorPaletteSlot& slot = history.PaletteLookup.Data[ColorPaletteLookupFind(history, key)];
+    if (slot.Index >= 0)
+        return false;
+    slot.Key = key;
+    slot.Index = history.Palette.Size;
+    history.Palette.push_back(ImGui::ColorConvertU32ToFloat4(key));
+    return true;
+}
+
+bool ImGui::AddPaletteColor(const ImVec4& col)
+{
+    ImGuiContext& g = *GImGui;
+    if (!ColorPaletteAdd(g.ColorHistory, ColorConvertFloat4ToU32(col)))
+        return false;
+    MarkIniSettingsDirty();
+    return true;
+}
+
+int ImGui::FindPaletteColor(const ImVec4& col)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiColorHistory& history = g.ColorHistory;
+    if (history.Palette.Size == 0)
+        return -1;
+    return history.PaletteLookup[ColorPaletteLookupFind(history, ColorConvertFloat4ToU32(col))].Index;
+}
+
+void ImGui::RemovePaletteColor(int index)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiColorHistory& history = g.ColorHistory;
+    IM_ASSERT(index >= 0 && index < history.Palette.Size);
+    history.Palette.erase(history.Palette.Data + index);
+    ColorPaletteLookupRebuild(history, history.Palette.Size); // Indices changed
+    MarkIniSettingsDirty();
+}
+
+void ImGui::ClearPaletteColors()
+{
+    ImGuiContext& g = *GImGui;
+    g.ColorHistory.Palette.clear();
+    g.ColorHistory.PaletteLookup.clear();
+    MarkIniSettingsDirty();
+}
+
+const ImVec4* ImGui::GetPaletteColors(int* out_count)
+{
+    ImGuiContext& g = *GImGui;
+    *out_count = g.ColorHistory.Palette.Size;
+    return g.ColorHistory.Palette.Data;
+}
+
+static int IMGUI_CDECL ColorPaletteSettingsChunkComparerByStart(const void* lhs, const void* rhs)
+{
+    const int a = ((const ImGuiColorPaletteSettingsChunk*)lhs)->Start;
+    const int b = ((const ImGuiColorPaletteSettingsChunk*)rhs)->Start;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+// The palette is saved as "[ColorPalette][<index of first color>]" entries of IM_COLOR_PALETTE_SETTINGS_CHUNK colors,
+// each color as 8 hexadecimal digits (RRGGBBAA), 64 colors per "Colors=" line.
+static void* ColorPaletteSettingsHandler_ReadOpen(ImGuiContext* ctx, ImGuiSettingsHandler*, const char* name)
+{
+    ImGuiColorHistory& history = ctx->ColorHistory;
+    ImGuiColorPaletteSettingsChunk chunk;
+    if (!ImStrParseInt(name, &chunk.Start) || chunk.Start < 0)
+        return NULL;
+    chunk.KeysOffset = history.SettingsKeys.Size;
+    chunk.KeysCount = 0;
+    history.SettingsChunks.push_back(chunk);
+    return (void*)&history;
+}
+
+static void ColorPaletteSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line)
+{
+    ImGuiColorHistory* history = (ImGuiColorHistory*)entry;
+    if (strncmp(line, "Colors=", 7) != 0)
+        return;
+    unsigned int v;
+    for (const char* p = line + 7, *p_next; (p_next = ImStrParseHex(p, 8, &v)) != NULL && p_next == p + 8; p = p_next)
+    {
+        history->SettingsKeys.push_back(IM_COL32(v >> 24, (v >> 16) & 0xFF, (v >> 8) & 0xFF, v & 0xFF));
+        history->SettingsChunks.back().KeysCount++;
+    }
+}
+
+// Add the colors read, in palette order
+static void ColorPaletteSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandler*)
+{
+    ImGuiColorHistory& history = ctx->ColorHistory;
+    ImVector<ImGuiColorPaletteSettingsChunk>& chunks = history.SettingsChunks;
+    if (chunks.Size > 1)
+        ImQsort(chunks.Data, (size_t)chunks.Size, sizeof(ImGuiColorPaletteSettingsChunk), ColorPaletteSettingsChunkComparerByStart);
+    for (int chunk_n = 0; chunk_n < chunks.Size; chunk_n++)
+        for (int key_n = 0; key_n < chunks[chunk_n].KeysCount; key_n++)
+            ColorPaletteAdd(history, history.SettingsKeys[chunks[chunk_n].KeysOffset + key_n]);
+    chunks.clear();
+    history.SettingsKeys.clear();
+}
+
+static void ColorPaletteSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+{
+    static const char hex_digits[] = "0123456789ABCDEF";
+    const ImVector<ImVec4>& palette = ctx->ColorHistory.Palette;
+    const int colors_per_line = 64;
+    char line[7 + colors_per_line * 8 + 1];
+    memcpy(line, "Colors=", 7);
+    buf->reserve(buf->size() + palette.Size * 8 + (palette.Size / colors_per_line + 1) * 8 + (palette.Size / IM_COLOR_PALETTE_SETTINGS_CHUNK + 1) * 32);
+    for (int chunk_start = 0; chunk_start < palette.Size; chunk_start += IM_COLOR_PALETTE_SETTINGS_CHUNK)
+    {
+        buf->appendf("[%s][%d]\n", handler->TypeName, chunk_start);
+        const int chunk_end = ImMin(chunk_start + IM_COLOR_PALETTE_SETTINGS_CHUNK, palette.Size);
+        for (int line_start = chunk_start; line_start < chunk_end; line_start += colors_per_line)
+        {
+            char* p = line + 7;
+            for (int n = line_start; n < ImMin(line_start + colors_per_line, chunk_end); n++)
+            {
+                const ImU32 c = ImGui::ColorConvertFloat4ToU32(palette.Data[n]);
+                const ImU32 v = (((c >> IM_COL32_R_SHIFT) & 0xFF) << 24) | (((c >> IM_COL32_G_SHIFT) & 0xFF) << 16) | (((c >> IM_COL32_B_SHIFT) & 0xFF) << 8) | ((c >> IM_COL32_A_SHIFT) & 0xFF);
+                for (int shift = 28; shift >= 0; shift -= 4)
+                    *p++ = hex_digits[(v >> shift) & 0x0F];
+            }
+            *p++ = '\n';
+            buf->append(line, p);
+        }
+        buf->append("\n");
+    }
+}
+
+void ImGui::ColorPaletteSettingsInstallHandler(ImGuiContext* context)
+{
+    ImGuiContext& g = *context;
+    ImGuiSettingsHandler ini_handler;
+    ini_handler.TypeName = "ColorPalette";
+    ini_handler.TypeHash = ImHashStr("ColorPalette");
+    ini_handler.ReadOpenFn = ColorPaletteSettingsHandler_ReadOpen;
+    ini_handler.ReadLineFn = ColorPaletteSettingsHandler_ReadLine;
+    ini_handler.ApplyAllFn = ColorPaletteSettingsHandler_ApplyAll;
+    ini_handler.WriteAllFn = ColorPaletteSettingsHandler_WriteAll;
+    g.SettingsHandlers.push_back(ini_handler);
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: TreeNode, CollapsingHeader, etc.
 //-------------------------------------------------------------------------
@@ -5811,28 +6903,9 @@ bool ImGui::ListBox(const char* label, int* current_item, bool (*items_getter)(v
     if (!ListBoxHeader(label, items_count, height_in_items))
         return false;
 
-    // Assume all items have even height (= 1 line of text). If you need items of different or variable sizes you can create a custom version of ListBox() in your code without using the clipper.
+    // Assume all items have even height (= 1 line of text). If you need items of different or variable sizes you can create a custom version of ListBox() in your code using ImGuiListClipper::BeginVariable().
     ImGuiContext& g = *GImGui;
-    bool value_changed = false;
-    ImGuiListClipper clipper(items_count, GetTextLineHeightWithSpacing()); // We know exactly our line height here so we pass it as a minor optimization, but generally you don't need to.
-    while (clipper.Step())
-        for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
-        {
-            const bool item_selected = (i == *current_item);
-            const char* item_text;
-            if (!items_getter(data, i, &item_text))
-                item_text = "*Unknown item*";
-
-            PushID(i);
-            if (Selectable(item_text, item_selected))
-            {
-                *current_item = i;
-                value_changed = true;
-            }
-            if (item_selected)
-                SetItemDefaultFocus();
-            PopID();
-        }
+    bool value_changed = ItemsSelectableClipped(current_item, items_getter, data, items_count, false);
     ListBoxFooter();
     if (value_changed)
         MarkItemEdited(g.CurrentWindow->DC.LastItemId);
@@ -5848,7 +6921,300 @@ bool ImGui::ListBox(const char* label, int* current_item, bool (*items_getter)(v
 // - PlotHistogram()
 //-------------------------------------------------------------------------
 
-int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size)
+struct ImGuiPlotArrayGetterData
+{
+    const float* Values;
+    int Stride;
+
+    ImGuiPlotArrayGetterData(const float* values, int stride) { Values = values; Stride = stride; }
+};
+
+static float Plot_ArrayGetter(void* data, int idx)
+{
+    ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
+    const float v = *(const float*)(const void*)((const unsigned char*)plot_data->Values + (size_t)idx * plot_data->Stride);
+    return v;
+}
+
+// Values read by PlotEx(). Values arrays are read directly instead of calling Plot_ArrayGetter() once per value.
+struct ImGuiPlotValues
+{
+    float (*Getter)(void* data, int idx);
+    void* Data;
+    const unsigned char* Array;     // Non-NULL when plotting a values array
+    int Stride;
+
+    ImGuiPlotValues(float (*values_getter)(void* data, int idx), void* data)
+    {
+        Getter = values_getter;
+        Data = data;
+        Array = NULL;
+        Stride = 0;
+        if (values_getter == &Plot_ArrayGetter)
+        {
+            ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
+            Array = (const unsigned char*)plot_data->Values;
+            Stride = plot_data->Stride;
+        }
+    }
+    float Get(int idx) const { return Array ? *(const float*)(const void*)(Array + (size_t)idx * Stride) : Getter(Data, idx); }
+};
+
+// Min/max of values [idx_min, idx_max). NaN values are ignored (all comparisons with NaN are false).
+// An empty range or a range of NaN values returns (FLT_MAX, -FLT_MAX).
+static ImVec2 PlotCalcMinMaxRaw(const ImGuiPlotValues& values, int idx_min, int idx_max)
+{
+    float v_min = FLT_MAX;
+    float v_max = -FLT_MAX;
+    if (values.Array && values.Stride == sizeof(float))
+    {
+        const float* p = (const float*)(const void*)values.Array;
+        for (int i = idx_min; i < idx_max; i++)
+        {
+            const float v = p[i];
+            v_min = (v < v_min) ? v : v_min;
+            v_max = (v > v_max) ? v : v_max;
+        }
+    }
+    else if (values.Array)
+    {
+        const unsigned char* p = values.Array + (size_t)idx_min * values.Stride;
+        for (int i = idx_min; i < idx_max; i++, p += values.Stride)
+        {
+            const float v = *(const float*)(const void*)p;
+            v_min = (v < v_min) ? v : v_min;
+            v_max = (v > v_max) ? v : v_max;
+        }
+    }
+    else
+    {
+        for (int i = idx_min; i < idx_max; i++)
+        {
+            const float v = values.Getter(values.Data, i);
+            v_min = (v < v_min) ? v : v_min;
+            v_max = (v > v_max) ? v : v_max;
+        }
+    }
+    return ImVec2(v_min, v_max);
+}
+
+// Add the buckets completed by new values to the pyramid. Only the new values are read.
+static void PlotCacheAddValues(ImGuiPlotCache* cache, const ImGuiPlotValues& values, int values_count)
+{
+    ImVector<ImVec2>& level0 = cache->Levels[0];
+    const int level0_count = values_count >> IM_PLOT_CACHE_BUCKET_SHIFT;
+    for (int i = level0.Size; i < level0_count; i++)
+        level0.push_back(PlotCalcMinMaxRaw(values, i << IM_PLOT_CACHE_BUCKET_SHIFT, (i + 1) << IM_PLOT_CACHE_BUCKET_SHIFT));
+    for (int level = 1; level < IM_PLOT_CACHE_LEVELS; level++)
+    {
+        const ImVector<ImVec2>& src = cache->Levels[level - 1];
+        ImVector<ImVec2>& dst = cache->Levels[level];
+        if (dst.Size == (src.Size >> 1))
+            break;
+        for (int i = dst.Size; i < (src.Size >> 1); i++)
+            dst.push_back(ImVec2(ImMin(src[i * 2].x, src[i * 2 + 1].x), ImMax(src[i * 2].y, src[i * 2 + 1].y)));
+    }
+    cache->ValuesCount = values_count;
+}
+
+// Min/max of values [idx_min, idx_max) using the largest aligned buckets of the pyramid, and raw values for the partial buckets at both ends.
+static ImVec2 PlotCacheCalcMinMax(const ImGuiPlotCache* cache, const ImGuiPlotValues& values, int idx_min, int idx_max)
+{
+    IM_ASSERT(idx_min <= idx_max && idx_max <= cache->ValuesCount);
+    const int bucket_mask = (1 << IM_PLOT_CACHE_BUCKET_SHIFT) - 1;
+    const int bucket_min = (int)(((ImS64)idx_min + bucket_mask) >> IM_PLOT_CACHE_BUCKET_SHIFT);
+    const int bucket_max = idx_max >> IM_PLOT_CACHE_BUCKET_SHIFT;
+    if (bucket_min >= bucket_max)
+        return PlotCalcMinMaxRaw(values, idx_min, idx_max);
+
+    ImVec2 r = PlotCalcMinMaxRaw(values, idx_min, bucket_min << IM_PLOT_CACHE_BUCKET_SHIFT);
+    for (int bucket = bucket_min; bucket < bucket_max; )
+    {
+        int level = 0;
+        while (level + 1 < IM_PLOT_CACHE_LEVELS && (bucket & ((2 << level) - 1)) == 0 && bucket + (2 << level) <= bucket_max)
+            level++;
+        const ImVec2 b = cache->Levels[level][bucket >> level];
+        r.x = ImMin(r.x, b.x);
+        r.y = ImMax(r.y, b.y);
+        bucket += 1 << level;
+    }
+    const ImVec2 tail = PlotCalcMinMaxRaw(values, bucket_max << IM_PLOT_CACHE_BUCKET_SHIFT, idx_max);
+    return ImVec2(ImMin(r.x, tail.x), ImMax(r.y, tail.y));
+}
+
+// Min/max of displayed values [idx_min, idx_max), i.e. of values (idx + values_offset) % values_count: at most two ranges of values.
+static ImVec2 PlotCalcMinMax(const ImGuiPlotCache* cache, const ImGuiPlotValues& values, int values_count, int values_offset, int idx_min, int idx_max)
+{
+    const int start = (int)(((ImS64)idx_min + values_offset) % values_count);
+    const int count = idx_max - idx_min;
+    if (count <= values_count - start)
+        return cache ? PlotCacheCalcMinMax(cache, values, start, start + count) : PlotCalcMinMaxRaw(values, start, start + count);
+    const ImVec2 a = cache ? PlotCacheCalcMinMax(cache, values, start, values_count) : PlotCalcMinMaxRaw(values, start, values_count);
+    const ImVec2 b = cache ? PlotCacheCalcMinMax(cache, values, 0, count - (values_count - start)) : PlotCalcMinMaxRaw(values, 0, count - (values_count - start));
+    return ImVec2(ImMin(a.x, b.x), ImMax(a.y, b.y));
+}
+
+static inline float PlotValueToY(float v, float scale_min, float inv_scale, const ImRect& inner_bb)
+{
+    return ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v - scale_min) * inv_scale));
+}
+
+// Batched emission for PlotEx(): primitives are written directly into space reserved by one PrimReserve() per chunk, instead of one
+// PathStroke() + PrimReserve() per AddLine() call. Lines use the same geometry as AddLine() with a thickness of 1.0f.
+// Hovered primitives are skipped and drawn over the batch with the hovered color by End().
+struct ImGuiPlotPrimBatch
+{
+    enum { ChunkSize = 4096 };      // Keep each reservation well under 64K vertices, so 16-bit indices work with ImDrawListFlags_AllowVtxOffset
+
+    ImDrawList*     DrawList;
+    bool            Lines;          // Lines or filled rectangles
+    bool            AntiAliased;
+    ImU32           Col;
+    ImU32           ColTrans;
+    ImVec2          ClipMin, ClipMax;
+    int             IdxPerPrim, VtxPerPrim;
+    int             PrimsLeft;      // Upper bound of primitives left to write
+    int             PrimsReserved;  // Reserved and not written yet
+    ImVec2          Hovered[4];     // Up to 2 hovered primitives
+    int             HoveredCount;
+
+    ImGuiPlotPrimBatch(ImDrawList* draw_list, bool lines, ImU32 col, int prims_max)
+    {
+        DrawList = draw_list;
+        Lines = lines;
+        AntiAliased = lines && (draw_list->Flags & ImDrawListFlags_AntiAliasedLines) != 0;
+        Col = col;
+        ColTrans = col & ~IM_COL32_A_MASK;
+        ClipMin = draw_list->GetClipRectMin() - ImVec2(1.0f, 1.0f);
+        ClipMax = draw_list->GetClipRectMax() + ImVec2(1.0f, 1.0f);
+        IdxPerPrim = AntiAliased ? 12 : 6;
+        VtxPerPrim = AntiAliased ? 6 : 4;
+        PrimsLeft = ((col & IM_COL32_A_MASK) != 0) ? prims_max : 0;
+        PrimsReserved = 0;
+        HoveredCount = 0;
+    }
+
+    void Add(ImVec2 a, ImVec2 b, bool hovered)
+    {
+        if (hovered)
+        {
+            if (HoveredCount < IM_ARRAYSIZE(Hovered))
+            {
+                Hovered[HoveredCount++] = a;
+                Hovered[HoveredCount++] = b;
+            }
+            return;
+        }
+        if (PrimsLeft == 0 || ImMax(a.x, b.x) < ClipMin.x || ImMin(a.x, b.x) > ClipMax.x || ImMax(a.y, b.y) < ClipMin.y || ImMin(a.y, b.y) > ClipMax.y)
+            return;
+        if (PrimsReserved == 0)
+        {
+            PrimsReserved = ImMin(PrimsLeft, (int)ChunkSize);
+            DrawList->PrimReserve(PrimsReserved * IdxPerPrim, PrimsReserved * VtxPerPrim);
+        }
+        PrimsReserved--;
+        PrimsLeft--;
+        if (!Lines)
+        {
+            DrawList->PrimRect(a, b, Col);
+            return;
+        }
+
+        a.x += 0.5f; a.y += 0.5f;
+        b.x += 0.5f; b.y += 0.5f;
+        float nx = b.x - a.x;
+        float ny = b.y - a.y;
+        const float d2 = nx * nx + ny * ny;
+        if (d2 > 0.0f)
+        {
+            const float inv_len = 1.0f / ImSqrt(d2);
+            nx *= inv_len;
+            ny *= inv_len;
+        }
+        const ImVec2 uv = DrawList->_Data->TexUvWhitePixel;
+        ImDrawVert* vtx = DrawList->_VtxWritePtr;
+        ImDrawIdx* idx = DrawList->_IdxWritePtr;
+        const unsigned int idx1 = DrawList->_VtxCurrentIdx;
+        if (AntiAliased)
+        {
+            // Same as AddPolyline() with 2 points: the normal is (ny, -nx) at both ends, with an AA fringe of 1.0f
+            const unsigned int idx2 = idx1 + 3;
+            vtx[0].pos = a;                          vtx[0].uv = uv; vtx[0].col = Col;
+            vtx[1].pos = ImVec2(a.x + ny, a.y - nx); vtx[1].uv = uv; vtx[1].col = ColTrans;
+            vtx[2].pos = ImVec2(a.x - ny, a.y + nx); vtx[2].uv = uv; vtx[2].col = ColTrans;
+            vtx[3].pos = b;                          vtx[3].uv = uv; vtx[3].col = Col;
+            vtx[4].pos = ImVec2(b.x + ny, b.y - nx); vtx[4].uv = uv; vtx[4].col = ColTrans;
+            vtx[5].pos = ImVec2(b.x - ny, b.y + nx); vtx[5].uv = uv; vtx[5].col = ColTrans;
+            idx[0] = (ImDrawIdx)(idx2+0); idx[1] = (ImDrawIdx)(idx1+0); idx[2] = (ImDrawIdx)(idx1+2);
+            idx[3] = (ImDrawIdx)(idx1+2); idx[4] = (ImDrawIdx)(idx2+2); idx[5] = (ImDrawIdx)(idx2+0);
+            idx[6] = (ImDrawIdx)(idx2+1); idx[7] = (ImDrawIdx)(idx1+1); idx[8] = (ImDrawIdx)(idx1+0);
+            idx[9] = (ImDrawIdx)(idx1+0); idx[10]= (ImDrawIdx)(idx2+0); idx[11]= (ImDrawIdx)(idx2+1);
+        }
+        else
+        {
+            // Same as AddPolyline() without anti-aliasing: a quad of 1.0f thickness
+            nx *= 0.5f;
+            ny *= 0.5f;
+            vtx[0].pos = ImVec2(a.x + ny, a.y - nx); vtx[0].uv = uv; vtx[0].col = Col;
+            vtx[1].pos = ImVec2(b.x + ny, b.y - nx); vtx[1].uv = uv; vtx[1].col = Col;
+            vtx[2].pos = ImVec2(b.x - ny, b.y + nx); vtx[2].uv = uv; vtx[2].col = Col;
+            vtx[3].pos = ImVec2(a.x - ny, a.y + nx); vtx[3].uv = uv; vtx[3].col = Col;
+            idx[0] = (ImDrawIdx)(idx1); idx[1] = (ImDrawIdx)(idx1+1); idx[2] = (ImDrawIdx)(idx1+2);
+            idx[3] = (ImDrawIdx)(idx1); idx[4] = (ImDrawIdx)(idx1+2); idx[5] = (ImDrawIdx)(idx1+3);
+        }
+        DrawList->_VtxWritePtr += VtxPerPrim;
+        DrawList->_IdxWritePtr += IdxPerPrim;
+        DrawList->_VtxCurrentIdx += VtxPerPrim;
+    }
+
+    void End(ImU32 col_hovered)
+    {
+        if (PrimsReserved > 0)
+            DrawList->PrimUnreserve(PrimsReserved * IdxPerPrim, PrimsReserved * VtxPerPrim);
+        PrimsReserved = 0;
+        for (int n = 0; n < HoveredCount; n += 2)
+        {
+            if (Lines)
+                DrawList->AddLine(Hovered[n], Hovered[n + 1], col_hovered);
+            else
+                DrawList->AddRectFilled(Hovered[n], Hovered[n + 1], col_hovered);
+        }
+    }
+};
+
+static ImGuiPlotCache* PlotGetCache(ImGuiID id, const ImGuiPlotValues& values, int values_count)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiPlotCache* cache = NULL;
+    for (int n = 0; n < g.PlotCaches.Size && cache == NULL; n++)
+        if (g.PlotCaches[n]->ID == id)
+            cache = g.PlotCaches[n];
+    if (cache == NULL)
+    {
+        cache = IM_NEW(ImGuiPlotCache)();
+        cache->ID = id;
+        g.PlotCaches.push_back(cache);
+    }
+
+    // Rebuild when the values are not the same series anymore (values arrays are identified by their address, the getter data may be a temporary)
+    const void* cache_data = values.Array ? (const void*)values.Array : values.Data;
+    if (cache->ValuesGetter != values.Getter || cache->Data != cache_data || cache->Stride != values.Stride || values_count < cache->ValuesCount)
+    {
+        for (int level = 0; level < IM_PLOT_CACHE_LEVELS; level++)
+            cache->Levels[level].resize(0);
+        cache->ValuesGetter = values.Getter;
+        cache->Data = cache_data;
+        cache->Stride = values.Stride;
+        cache->ValuesCount = 0;
+    }
+    cache->LastFrameActive = g.FrameCount;
+    cache->LastTimeActive = (float)g.Time;
+    if (cache->ValuesCount != values_count)
+        PlotCacheAddValues(cache, values, values_count);
+    return cache;
+}
+
+int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size, ImGuiPlotFlags flags)
 {
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = GetCurrentWindow();
@@ -5871,32 +7237,96 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
     if (!ItemAdd(total_bb, 0, &frame_bb))
         return -1;
     const bool hovered = ItemHoverable(frame_bb, id);
+    const ImGuiPlotValues values(values_getter, data);
+
+    RenderFrame(frame_bb.Min, frame_bb.Max, GetColorU32(ImGuiCol_FrameBg), true, style.FrameRounding);
 
-    // Determine scale from values if not specified
-    if (scale_min == FLT_MAX || scale_max == FLT_MAX)
+    const int values_count_min = (plot_type == ImGuiPlotType_Lines) ? 2 : 1;
+    int idx_hovered = -1;
+    if (values_count >= values_count_min && values_count > (int)frame_size.x && (int)frame_size.x >= values_count_min)
     {
+        // More values than pixels: each column displays the min/max range of its values, so peaks are never missed.
+        // The cache makes the cost of a column O(log(values_count)) instead of O(values_count / columns).
+        ImGuiPlotCache* cache = (flags & ImGuiPlotFlags_CacheValues) ? PlotGetCache(id, values, values_count) : NULL;
+        const int col_count = (int)frame_size.x;
+        ImVec2* cols_min_max = (ImVec2*)IM_ALLOC_FRAME(col_count * sizeof(ImVec2));
         float v_min = FLT_MAX;
         float v_max = -FLT_MAX;
-        for (int i = 0; i < values_count; i++)
+        for (int n = 0; n < col_count; n++)
         {
-            const float v = values_getter(data, i);
-            if (v != v) // Ignore NaN values
-                continue;
-            v_min = ImMin(v_min, v);
-            v_max = ImMax(v_max, v);
+            cols_min_max[n] = PlotCalcMinMax(cache, values, values_count, values_offset, (int)((ImS64)n * values_count / col_count), (int)((ImS64)(n + 1) * values_count / col_count));
+            v_min = ImMin(v_min, cols_min_max[n].x);
+            v_max = ImMax(v_max, cols_min_max[n].y);
         }
         if (scale_min == FLT_MAX)
             scale_min = v_min;
         if (scale_max == FLT_MAX)
             scale_max = v_max;
-    }
 
-    RenderFrame(frame_bb.Min, frame_bb.Max, GetColorU32(ImGuiCol_FrameBg), true, style.FrameRounding);
+        // Tooltip on hover
+        const int res_w = col_count + ((plot_type == ImGuiPlotType_Lines) ? -1 : 0);
+        int col_hovered = -1;
+        if (hovered && inner_bb.Contains(g.IO.MousePos))
+        {
+            const float t = ImClamp((g.IO.MousePos.x - inner_bb.Min.x) / (inner_bb.Max.x - inner_bb.Min.x), 0.0f, 0.9999f);
+            col_hovered = (plot_type == ImGuiPlotType_Lines) ? (int)(t * res_w + 0.5f) : (int)(t * res_w);
+            const int v_idx_min = (int)((ImS64)col_hovered * values_count / col_count);
+            const int v_idx_max = (int)((ImS64)(col_hovered + 1) * values_count / col_count) - 1;
+            SetTooltip("%d-%d: %8.4g .. %8.4g", v_idx_min, v_idx_max, cols_min_max[col_hovered].x, cols_min_max[col_hovered].y);
+            idx_hovered = v_idx_min;
+        }
 
-    const int values_count_min = (plot_type == ImGuiPlotType_Lines) ? 2 : 1;
-    int idx_hovered = -1;
-    if (values_count >= values_count_min)
+        const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
+        const float histogram_zero_line_y = ImLerp(inner_bb.Min.y, inner_bb.Max.y, (scale_min * scale_max < 0.0f) ? (-scale_min * inv_scale) : (scale_min < 0.0f ? 0.0f : 1.0f));
+        const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
+        const ImU32 col_hovered_u32 = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
+
+        ImGuiPlotPrimBatch batch(window->DrawList, plot_type == ImGuiPlotType_Lines, col_base, (plot_type == ImGuiPlotType_Lines) ? col_count * 2 : col_count);
+        float x0 = inner_bb.Min.x;
+        float y_last = 0.0f;
+        for (int n = 0; n < col_count; n++)
+        {
+            const ImVec2 min_max = cols_min_max[n];
+            if (plot_type == ImGuiPlotType_Lines)
+            {
+                // Join the last value of the previous column to the first value of this one, then cover the min/max range of the column
+                const float x = ImLerp(inner_bb.Min.x, inner_bb.Max.x, (float)n / (float)res_w);
+                const int v_idx_first = (int)((ImS64)n * values_count / col_count);
+                const int v_idx_last = (int)((ImS64)(n + 1) * values_count / col_count) - 1;
+                const float y_first = PlotValueToY(values.Get((int)(((ImS64)v_idx_first + values_offset) % values_count)), scale_min, inv_scale, inner_bb);
+                if (n > 0)
+                    batch.Add(ImVec2(x0, y_last), ImVec2(x, y_first), n == col_hovered);
+                if (min_max.x < min_max.y)
+                    batch.Add(ImVec2(x, PlotValueToY(min_max.y, scale_min, inv_scale, inner_bb)), ImVec2(x, PlotValueToY(min_max.x, scale_min, inv_scale, inner_bb)), n == col_hovered);
+                y_last = (v_idx_last == v_idx_first) ? y_first : PlotValueToY(values.Get((int)(((ImS64)v_idx_last + values_offset) % values_count)), scale_min, inv_scale, inner_bb);
+                x0 = x;
+            }
+            else if (plot_type == ImGuiPlotType_Histogram)
+            {
+                float x1 = ImLerp(inner_bb.Min.x, inner_bb.Max.x, (float)(n + 1) / (float)res_w);
+                if (min_max.x <= min_max.y)
+                {
+                    const float y0 = ImMin(PlotValueToY(min_max.y, scale_min, inv_scale, inner_bb), histogram_zero_line_y);
+                    const float y1 = ImMax(PlotValueToY(min_max.x, scale_min, inv_scale, inner_bb), histogram_zero_line_y);
+                    batch.Add(ImVec2(x0, y0), ImVec2((x1 >= x0 + 2.0f) ? x1 - 1.0f : x1, y1), n == col_hovered);
+                }
+                x0 = x1;
+            }
+        }
+        batch.End(col_hovered_u32);
+    }
+    else if (values_count >= values_count_min)
     {
+        // Determine scale from values if not specified
+        if (scale_min == FLT_MAX || scale_max == FLT_MAX)
+        {
+            const ImVec2 min_max = PlotCalcMinMaxRaw(values, 0, values_count);
+            if (scale_min == FLT_MAX)
+                scale_min = min_max.x;
+            if (scale_max == FLT_MAX)
+                scale_max = min_max.y;
+        }
+
         int res_w = ImMin((int)frame_size.x, values_count) + ((plot_type == ImGuiPlotType_Lines) ? -1 : 0);
         int item_count = values_count + ((plot_type == ImGuiPlotType_Lines) ? -1 : 0);
 
@@ -5907,8 +7337,8 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
             const int v_idx = (int)(t * item_count);
             IM_ASSERT(v_idx >= 0 && v_idx < values_count);
 
-            const float v0 = values_getter(data, (v_idx + values_offset) % values_count);
-            const float v1 = values_getter(data, (v_idx + 1 + values_offset) % values_count);
+            const float v0 = values.Get((v_idx + values_offset) % values_count);
+            const float v1 = values.Get((v_idx + 1 + values_offset) % values_count);
             if (plot_type == ImGuiPlotType_Lines)
                 SetTooltip("%d: %8.4g\n%d: %8.4g", v_idx, v0, v_idx+1, v1);
             else if (plot_type == ImGuiPlotType_Histogram)
@@ -5919,7 +7349,7 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
         const float t_step = 1.0f / (float)res_w;
         const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
 
-        float v0 = values_getter(data, (0 + values_offset) % values_count);
+        float v0 = values.Get((0 + values_offset) % values_count);
         float t0 = 0.0f;
         ImVec2 tp0 = ImVec2( t0, 1.0f - ImSaturate((v0 - scale_min) * inv_scale) );                       // Point in the normalized space of our target rectangle
         float histogram_zero_line_t = (scale_min * scale_max < 0.0f) ? (-scale_min * inv_scale) : (scale_min < 0.0f ? 0.0f : 1.0f);   // Where does the zero line stands
@@ -5927,31 +7357,25 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
         const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
         const ImU32 col_hovered = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
 
+        ImGuiPlotPrimBatch batch(window->DrawList, plot_type == ImGuiPlotType_Lines, col_base, ImMax(res_w, 0));
         for (int n = 0; n < res_w; n++)
         {
             const float t1 = t0 + t_step;
             const int v1_idx = (int)(t0 * item_count + 0.5f);
             IM_ASSERT(v1_idx >= 0 && v1_idx < values_count);
-            const float v1 = values_getter(data, (v1_idx + values_offset + 1) % values_count);
+            const float v1 = values.Get((v1_idx + values_offset + 1) % values_count);
             const ImVec2 tp1 = ImVec2( t1, 1.0f - ImSaturate((v1 - scale_min) * inv_scale) );
 
-            // NB: Draw calls are merged together by the DrawList system. Still, we should render our batch are lower level to save a bit of CPU.
             ImVec2 pos0 = ImLerp(inner_bb.Min, inner_bb.Max, tp0);
             ImVec2 pos1 = ImLerp(inner_bb.Min, inner_bb.Max, (plot_type == ImGuiPlotType_Lines) ? tp1 : ImVec2(tp1.x, histogram_zero_line_t));
-            if (plot_type == ImGuiPlotType_Lines)
-            {
-                window->DrawList->AddLine(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
-            }
-            else if (plot_type == ImGuiPlotType_Histogram)
-            {
-                if (pos1.x >= pos0.x + 2.0f)
-                    pos1.x -= 1.0f;
-                window->DrawList->AddRectFilled(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
-            }
+            if (plot_type == ImGuiPlotType_Histogram && pos1.x >= pos0.x + 2.0f)
+                pos1.x -= 1.0f;
+            batch.Add(pos0, pos1, idx_hovered == v1_idx);
 
             t0 = t1;
             tp0 = tp1;
         }
+        batch.End(col_hovered);
     }
 
     // Text overlay
@@ -5966,41 +7390,26 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
     return idx_hovered;
 }
 
-struct ImGuiPlotArrayGetterData
-{
-    const float* Values;
-    int Stride;
-
-    ImGuiPlotArrayGetterData(const float* values, int stride) { Values = values; Stride = stride; }
-};
-
-static float Plot_ArrayGetter(void* data, int idx)
-{
-    ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
-    const float v = *(const float*)(const void*)((const unsigned char*)plot_data->Values + (size_t)idx * plot_data->Stride);
-    return v;
-}
-
-void ImGui::PlotLines(const char* label, const float* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
+void ImGui::PlotLines(const char* label, const float* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride, ImGuiPlotFlags flags)
 {
     ImGuiPlotArrayGetterData data(values, stride);
-    PlotEx(ImGuiPlotType_Lines, label, &Plot_ArrayGetter, (void*)&data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
+    PlotEx(ImGuiPlotType_Lines, label, &Plot_ArrayGetter, (void*)&data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size, flags);
 }
 
-void ImGui::PlotLines(const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+void ImGui::PlotLines(const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, ImGuiPlotFlags flags)
 {
-    PlotEx(ImGuiPlotType_Lines, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
+    PlotEx(ImGuiPlotType_Lines, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size, flags);
 }
 
-void ImGui::PlotHistogram(const char* label, const float* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
+void ImGui::PlotHistogram(const char* label, const float* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride, ImGuiPlotFlags flags)
 {
     ImGuiPlotArrayGetterData data(values, stride);
-    PlotEx(ImGuiPlotType_Histogram, label, &Plot_ArrayGetter, (void*)&data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
+    PlotEx(ImGuiPlotType_Histogram, label, &Plot_ArrayGetter, (void*)&data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size, flags);
 }
 
-void ImGui::PlotHistogram(const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+void ImGui::PlotHistogram(const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, ImGuiPlotFlags flags)
 {
-    PlotEx(ImGuiPlotType_Histogram, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
+    PlotEx(ImGuiPlotType_Histogram, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size, flags);
 }
 
 //-------------------------------------------------------------------------
@@ -2,6 +2,7 @@
 // This is a slightly modified version of stb_textedit.h 1.13. 
 // Those changes would need to be pushed into nothings/stb:
 // - Fix in stb_textedit_discard_redo (see https://github.com/nothings/stb/issues/321)
+// - Optional STB_TEXTEDIT_FINDROW_Y / STB_TEXTEDIT_FINDROW_CHAR hooks to skip rows without laying them out
 // Grep for [DEAR IMGUI] to find the changes.
 
 // stb_textedit.h - v1.13  - public domain - Sean Barrett
@@ -404,6 +405,11 @@ static int stb_text_locate_coord(STB_TEXTEDIT_STRING *str, float x, float y)
    r.ymin = r.ymax = 0;
    r.num_chars = 0;
 
+   // [DEAR IMGUI] Let the client seek to the row straddling 'y' instead of laying out all rows above it
+   #ifdef STB_TEXTEDIT_FINDROW_Y
+   STB_TEXTEDIT_FINDROW_Y(str, y, &i, &base_y);
+   #endif
+
    // search rows to find one that straddles 'y'
    while (i < n) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
@@ -534,6 +540,13 @@ static void stb_textedit_find_charpos(StbFindState *find, STB_TEXTEDIT_STRING *s
          find->y = 0;
          find->x = 0;
          find->height = 1;
+         // [DEAR IMGUI] Let the client seek to the last row instead of laying out all rows
+         #ifdef STB_TEXTEDIT_FINDROW_CHAR
+         {
+            float row_y;
+            STB_TEXTEDIT_FINDROW_CHAR(str, z > 0 ? z - 1 : 0, &i, &prev_start, &row_y);
+         }
+         #endif
          while (i < z) {
             STB_TEXTEDIT_LAYOUTROW(&r, str, i);
             prev_start = i;
@@ -549,6 +562,11 @@ static void stb_textedit_find_charpos(StbFindState *find, STB_TEXTEDIT_STRING *s
    // search rows to find the one that straddles character n
    find->y = 0;
 
+   // [DEAR IMGUI] Let the client seek to the row straddling character n instead of laying out all rows above it
+   #ifdef STB_TEXTEDIT_FINDROW_CHAR
+   STB_TEXTEDIT_FINDROW_CHAR(str, n, &i, &prev_start, &find->y);
+   #endif
+
    for(;;) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
       if (n < i + r.num_chars)